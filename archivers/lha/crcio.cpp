@@ -11,6 +11,9 @@
 /* ------------------------------------------------------------------------ */
 static unsigned short crctable[UCHAR_MAX + 1];
 static unsigned char subbitbuf, bitcount;
+/* compressed input is read in blocks instead of one zfile_getc per byte */
+static unsigned char inbuf[4096];
+static unsigned int inbufpos, inbuflen;
 #ifdef EUC
 static int      putc_euc_cache;
 #endif
@@ -71,7 +74,11 @@ fillbuf(unsigned char n)			/* Shift bitbuf n bits left, read n bits */
 		lhabitbuf = (lhabitbuf << bitcount) + (subbitbuf >> (CHAR_BIT - bitcount));
 		if (compsize != 0) {
 			compsize--;
-			subbitbuf = (unsigned char) zfile_getc(infile);
+			if (inbufpos >= inbuflen) {
+				inbuflen = zfile_fread(inbuf, 1, compsize + 1 < sizeof inbuf ? compsize + 1 : sizeof inbuf, infile);
+				inbufpos = 0;
+			}
+			subbitbuf = inbufpos < inbuflen ? inbuf[inbufpos++] : (unsigned char) EOF;
 		}
 		else
 			subbitbuf = 0;
@@ -187,6 +194,7 @@ init_getbits(void)
 	lhabitbuf = 0;
 	subbitbuf = 0;
 	bitcount = 0;
+	inbufpos = inbuflen = 0;
 	fillbuf(2 * CHAR_BIT);
 #ifdef EUC
 	putc_euc_cache = EOF;
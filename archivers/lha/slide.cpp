@@ -429,6 +429,19 @@ int decode(struct interfacing *lhinterface)
 			fprintf(fout, "%u M %u %u ", count, (loc-1-i) & dicsiz1, j);
 #endif
 			lhcount += j;
+#ifndef DEBUG
+			/* match does not wrap and does not fill the dictionary */
+			if (i + j <= dicsiz && loc + j < dicsiz) {
+				if (i + j <= loc || loc + j <= i) {
+					memcpy(dtext + loc, dtext + i, j);
+				} else {
+					for (k = 0; k < j; k++)
+						dtext[loc + k] = dtext[i + k];
+				}
+				loc += j;
+				continue;
+			}
+#endif
 			for (k = 0; k < j; k++) {
 				c = dtext[(i + k) & dicsiz1];
 
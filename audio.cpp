@@ -61,6 +61,16 @@ STATIC_INLINE bool isaudio (void)
 	return currprefs.produce_sound != 0;
 }
 
+// render-free warp mode: Paula state is emulated but no samples are generated
+STATIC_INLINE bool nosampleoutput (void)
+{
+#ifdef AVIOUTPUT
+	if (avioutput_enabled)
+		return false;
+#endif
+	return currprefs.turbo_emulation && currprefs.turbo_emulation_render > 0;
+}
+
 #if DEBUG_AUDIO > 0 || DEBUG_AUDIO_HACK > 0 || DEBUG_AUDIO2 > 0
 static bool debugchannel (int ch)
 {
@@ -570,6 +580,20 @@ static void anti_prehandler (unsigned long best_evtime)
 	}
 }
 
+/* Extra streams only: Paula channels are handled by their own interpolator */
+static void anti_prehandler_extra (unsigned long best_evtime)
+{
+	int i, output;
+	struct audio_channel_data2 *acd;
+
+	for (i = AUDIO_CHANNELS_PAULA; audio_data[i]; i++) {
+		acd = audio_data[i];
+		output = (acd->current_sample * acd->mixvol) & acd->adk_mask;
+		acd->sample_accum += output * best_evtime;
+		acd->sample_accum_time += best_evtime;
+	}
+}
+
 static void samplexx_anti_handler (int *datasp, int ch_start, int ch_num)
 {
 	int i, j;
@@ -1384,13 +1408,19 @@ STATIC_INLINE int is_audio_active (void)
 	return audio_work_to_do;
 }
 
-static void update_volume(int nr, uae_u16 v)
+static uae_u16 get_volume(uae_u16 v)
 {
-	struct audio_channel_data *cdp = audio_channel + nr;
 	// 7 bit register in Paula.
 	v &= 127;
 	if (v > 64)
 		v = 64;
+	return v;
+}
+
+static void update_volume(int nr, uae_u16 v)
+{
+	struct audio_channel_data *cdp = audio_channel + nr;
+	v = get_volume(v);
 	cdp->data.audvol = v;
 	if (!currprefs.sound_volcnt)
 		cdp->data.mixvol = v;
@@ -1921,7 +1951,7 @@ void check_prefs_changed_audio (void)
 static void set_extra_prehandler(void)
 {
 	if (audio_total_extra_streams && sample_prehandler != anti_prehandler) {
-		extra_sample_prehandler = anti_prehandler;
+		extra_sample_prehandler = anti_prehandler_extra;
 	} else {
 		extra_sample_prehandler = NULL;
 	}
@@ -2134,6 +2164,7 @@ static void update_audio_volcnt(int cycles, float evtime, bool nextsmp)
 void update_audio (void)
 {
 	unsigned long int n_cycles = 0;
+	bool nooutput = nosampleoutput ();
 #if SOUNDSTUFF > 1
 	static int samplecounter;
 #endif
@@ -2175,7 +2206,7 @@ void update_audio (void)
 		/* Decrease time-to-wait counters */
 		next_sample_evtime -= best_evtime;
 
-		if (currprefs.produce_sound > 1) {
+		if (currprefs.produce_sound > 1 && !nooutput) {
 			if (sample_prehandler)
 				sample_prehandler (best_evtime / CYCLE_UNIT);
 			if (extra_sample_prehandler)
@@ -2194,7 +2225,10 @@ void update_audio (void)
 		n_cycles -= best_evtime;
 
 		if (currprefs.produce_sound > 1) {
-			if (currprefs.sound_volcnt) {
+			if (nooutput) {
+				if (rounded == best_evtime)
+					next_sample_evtime += scaled_sample_evtime;
+			} else if (currprefs.sound_volcnt) {
 				bool nextsmp = false;
 				if (rounded == best_evtime) {
 					next_sample_evtime += scaled_sample_evtime;
@@ -2462,8 +2496,11 @@ void AUDxLEN (int nr, uae_u16 v)
 void AUDxVOL (int nr, uae_u16 v)
 {
 	struct audio_channel_data *cdp = audio_channel + nr;
+	uae_u16 vol = get_volume(v);
 
-	audio_activate ();
+	// players rewrite unchanged volumes every frame, skip audio catch up for them
+	if (!audio_activate () && cdp->data.audvol == vol && (currprefs.sound_volcnt || cdp->data.mixvol == vol))
+		return;
 	update_audio ();
 	update_volume(nr, v);
 #if DEBUG_AUDIO > 0
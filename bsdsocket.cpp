@@ -52,13 +52,11 @@ uae_u32 strncpyha(TrapContext *ctx, uae_u32 dst, const uae_char *src, int size)
 	if (trap_is_indirect()) {
 		trap_put_string(ctx, src, dst, size);
 	} else {
+		int len = 0;
 		if (!addr_valid(_T("strncpyha"), dst, size))
 			return res;
-		while (size--) {
-			put_byte (dst++, *src);
-			if (!*src++)
-				return res;
-		}
+		while (len < size && src[len++]);
+		trap_put_bytes(ctx, src, dst, len);
 	}
 	return res;
 }
@@ -69,11 +67,8 @@ uae_u32 addstr(TrapContext *ctx, uae_u32 * dst, const TCHAR *src)
 	int len;
 	char *s = ua(src);
 	len = strlen(s) + 1;
-	if (trap_is_indirect()) {
-		trap_put_bytes(ctx, dst, res, len);
-	} else {
-		strcpyha_safe (*dst, s);
-	}
+	if (trap_is_indirect() || addr_valid(_T("addstr"), res, len))
+		trap_put_bytes(ctx, s, res, len);
 	(*dst) += len;
 	xfree (s);
 	return res;
@@ -83,11 +78,8 @@ uae_u32 addstr_ansi(TrapContext *ctx, uae_u32 * dst, const uae_char *src)
 	uae_u32 res = *dst;
 	int len;
 	len = strlen (src) + 1;
-	if (trap_is_indirect()) {
-		trap_put_bytes(ctx, dst, res, len);
-	} else {
-		strcpyha_safe (*dst, src);
-	}
+	if (trap_is_indirect() || addr_valid(_T("addstr_ansi"), res, len))
+		trap_put_bytes(ctx, src, res, len);
 	(*dst) += len;
 	return res;
 }
@@ -98,11 +90,8 @@ uae_u32 addmem(TrapContext *ctx, uae_u32 * dst, const uae_char *src, int len)
 
 	if (!src)
 		return 0;
-	if (trap_is_indirect()) {
+	if (trap_is_indirect() || addr_valid(_T("addmem"), res, len))
 		trap_put_bytes(ctx, src, res, len);
-	} else {
-		memcpyha_safe (*dst, (uae_u8*)src, len);
-	}
 	(*dst) += len;
 
 	return res;
@@ -2632,6 +2632,7 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
 	cfgfile_dwrite_bool(f, _T("cpu_reset_pause"), p->reset_delay);
 	cfgfile_dwrite_bool(f, _T("cpu_halt_auto_reset"), p->crash_auto_reset);
 	cfgfile_dwrite_bool(f, _T("cpu_threaded"), p->cpu_thread);
+	cfgfile_dwrite_bool(f, _T("cpu_idle_busywait"), p->cpu_idle_busywait);
 	if (p->ppc_mode)
 		cfgfile_write_str(f, _T("ppc_implementation"), ppc_implementations[p->ppc_implementation]);
 
@@ -2698,6 +2699,7 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
 	cfgfile_dwrite_bool (f, _T("state_replay_autoplay"), p->inprec_autoplay);
 	cfgfile_dwrite_bool (f, _T("warp"), p->turbo_emulation);
 	cfgfile_dwrite (f, _T("warp_limit"), _T("%d"), p->turbo_emulation_limit);
+	cfgfile_dwrite (f, _T("warp_render_interval"), _T("%d"), p->turbo_emulation_render);
 
 #ifdef FILESYS
 	write_filesys_config (p, f);
@@ -3311,6 +3313,7 @@ static int cfgfile_parse_host (struct uae_prefs *p, TCHAR *option, TCHAR *value)
 		|| cfgfile_intval (option, value, _T("sampler_frequency"), &p->sampler_freq, 1)
 		|| cfgfile_intval (option, value, _T("sampler_buffer"), &p->sampler_buffer, 1)
 		|| cfgfile_intval(option, value, _T("warp_limit"), &p->turbo_emulation_limit, 1)
+		|| cfgfile_intval(option, value, _T("warp_render_interval"), &p->turbo_emulation_render, 1)
 		|| cfgfile_intval(option, value, _T("power_led_dim"), &p->power_led_dim, 1)
 
 		|| cfgfile_intval(option, value, _T("gfx_frame_slices"), &p->gfx_display_sections, 1)
@@ -5493,6 +5496,7 @@ static int cfgfile_parse_hardware (struct uae_prefs *p, const TCHAR *option, TCH
 		|| cfgfile_yesno(option, value, _T("genlock_aspect"), &p->genlock_aspect)
 		|| cfgfile_yesno(option, value, _T("cpu_data_cache"), &p->cpu_data_cache)
 		|| cfgfile_yesno(option, value, _T("cpu_threaded"), &p->cpu_thread)
+		|| cfgfile_yesno(option, value, _T("cpu_idle_busywait"), &p->cpu_idle_busywait)
 		|| cfgfile_yesno(option, value, _T("cpu_24bit_addressing"), &p->address_space_24)
 		|| cfgfile_yesno(option, value, _T("cpu_reset_pause"), &p->reset_delay)
 		|| cfgfile_yesno(option, value, _T("cpu_halt_auto_reset"), &p->crash_auto_reset)
@@ -6243,8 +6247,60 @@ static void calcformula (struct uae_prefs *prefs, TCHAR *in)
 	}
 }
 
+/* Remembers option names that only the host parser accepts so that
+ * they can bypass the long hardware option chain on the next load. */
+#define OPTION_OWNER_HASH_SIZE 4096
+static TCHAR *option_owner_name[OPTION_OWNER_HASH_SIZE];
+static int option_owner_cnt;
+
+static uae_u32 option_owner_hash (const TCHAR *option)
+{
+	uae_u32 h = 2166136261u;
+	while (*option) {
+		h ^= (uae_u32)*option++;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static bool option_owner_host (const TCHAR *option)
+{
+	uae_u32 h = option_owner_hash (option);
+	for (;;) {
+		TCHAR *s = option_owner_name[h & (OPTION_OWNER_HASH_SIZE - 1)];
+		if (!s)
+			return false;
+		if (!_tcscmp (s, option))
+			return true;
+		h++;
+	}
+}
+
+static void option_owner_set_host (const TCHAR *option)
+{
+	uae_u32 h;
+
+	// keep the table at most 3/4 full
+	if (option_owner_cnt >= OPTION_OWNER_HASH_SIZE * 3 / 4)
+		return;
+	h = option_owner_hash (option);
+	for (;;) {
+		TCHAR **s = &option_owner_name[h & (OPTION_OWNER_HASH_SIZE - 1)];
+		if (!*s) {
+			*s = my_strdup (option);
+			option_owner_cnt++;
+			return;
+		}
+		if (!_tcscmp (*s, option))
+			return;
+		h++;
+	}
+}
+
 int cfgfile_parse_option (struct uae_prefs *p, const TCHAR *option, TCHAR *value, int type)
 {
+	bool hostonly;
+
 	calcformula (p, value);
 
 	if (!_tcscmp (option, _T("debug"))) {
@@ -6261,7 +6317,8 @@ int cfgfile_parse_option (struct uae_prefs *p, const TCHAR *option, TCHAR *value
 		return 1;
 	if (cfgfile_path (option, value, _T("config_host_path"), p->config_host_path, sizeof p->config_host_path / sizeof(TCHAR)))
 		return 1;
-	if (type == 0 || (type & CONFIG_TYPE_HARDWARE)) {
+	hostonly = option_owner_host (option);
+	if (!hostonly && (type == 0 || (type & CONFIG_TYPE_HARDWARE))) {
 		if (cfgfile_parse_hardware (p, option, value))
 			return 1;
 	}
@@ -6270,6 +6327,8 @@ int cfgfile_parse_option (struct uae_prefs *p, const TCHAR *option, TCHAR *value
 		TCHAR* writable_option = my_strdup(option);
 		if (cfgfile_parse_host (p, writable_option, value)) {
 			free(writable_option);
+			if (!hostonly && (type == 0 || (type & CONFIG_TYPE_HARDWARE)))
+				option_owner_set_host (option);
 			return 1;
 		}
 		free(writable_option);
@@ -7897,8 +7956,10 @@ void default_prefs (struct uae_prefs *p, bool reset, int type)
 	p->scsi = 0;
 	p->uaeserial = 0;
 	p->cpu_idle = 0;
+	p->cpu_idle_busywait = false;
 	p->turbo_emulation = 0;
 	p->turbo_emulation_limit = 0;
+	p->turbo_emulation_render = 0;
 	p->headless = 0;
 	p->catweasel = 0;
 	p->tod_hack = 0;
@@ -8174,8 +8235,10 @@ static void buildin_default_prefs (struct uae_prefs *p)
 	p->scsi = 0;
 	p->uaeserial = 0;
 	p->cpu_idle = 0;
+	p->cpu_idle_busywait = false;
 	p->turbo_emulation = 0;
 	p->turbo_emulation_limit = 0;
+	p->turbo_emulation_render = 0;
 	p->catweasel = 0;
 	p->tod_hack = 0;
 	p->maprom = 0;
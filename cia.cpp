@@ -1065,7 +1065,9 @@ static uae_u8 ReadCIAA (unsigned int addr, uae_u32 *flags)
 	unsigned int tmp;
 	int reg = addr & 15;
 
-	compute_passed_time ();
+	// only timer counter reads need the elapsed time
+	if (reg >= 4 && reg <= 7)
+		compute_passed_time ();
 
 #if CIAA_DEBUG_R > 0
 	if (CIAA_DEBUG_R > 1 || (munge24 (M68K_GETPC) & 0xFFF80000) != 0xF80000)
@@ -1250,7 +1252,8 @@ static uae_u8 ReadCIAB (unsigned int addr, uae_u32 *flags)
 	}
 #endif
 
-	compute_passed_time ();
+	if (reg >= 4 && reg <= 7)
+		compute_passed_time ();
 
 	switch (reg) {
 	case 0:
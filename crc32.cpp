@@ -4,48 +4,66 @@
 
 #include "crc32.h"
 
-static unsigned long crc_table32[256];
+/* crc_table32[0] is the classic byte table, tables 1-7 extend it so
+ * that get_crc32 can consume eight bytes per step (slice-by-8). */
+static uae_u32 crc_table32[8][256];
 static unsigned short crc_table16[256];
 static void make_crc_table (void)
 {
-	unsigned long c;
+	uae_u32 c;
 	unsigned short w;
 	int n, k;
 	for (n = 0; n < 256; n++) {
-		c = (unsigned long)n;
+		c = (uae_u32)n;
 		w = n << 8;
 		for (k = 0; k < 8; k++) {
 			c = (c >> 1) ^ (c & 1 ? 0xedb88320 : 0);
 			w = (w << 1) ^ ((w & 0x8000) ? 0x1021 : 0);
 		}
-		crc_table32[n] = c;
+		crc_table32[0][n] = c;
 		crc_table16[n] = w;
 	}
+	for (n = 0; n < 256; n++) {
+		c = crc_table32[0][n];
+		for (k = 1; k < 8; k++) {
+			c = crc_table32[0][c & 0xff] ^ (c >> 8);
+			crc_table32[k][n] = c;
+		}
+	}
 }
 uae_u32 get_crc32_val (uae_u8 v, uae_u32 crc)
 {
-	if (!crc_table32[1])
+	if (!crc_table32[0][1])
 		make_crc_table();
 	crc ^= 0xffffffff;
-	crc = crc_table32[(crc ^ v) & 0xff] ^ (crc >> 8);
+	crc = crc_table32[0][(crc ^ v) & 0xff] ^ (crc >> 8);
 	return crc ^ 0xffffffff;
 }
 uae_u32 get_crc32 (void *vbuf, int len)
 {
 	uae_u8 *buf = (uae_u8*)vbuf;
 	uae_u32 crc;
-	if (!crc_table32[1])
+	if (!crc_table32[0][1])
 		make_crc_table();
 	crc = 0xffffffff;
+	while (len >= 8) {
+		uae_u32 v = crc ^ (buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uae_u32)buf[3] << 24));
+		crc = crc_table32[7][v & 0xff] ^ crc_table32[6][(v >> 8) & 0xff]
+			^ crc_table32[5][(v >> 16) & 0xff] ^ crc_table32[4][v >> 24]
+			^ crc_table32[3][buf[4]] ^ crc_table32[2][buf[5]]
+			^ crc_table32[1][buf[6]] ^ crc_table32[0][buf[7]];
+		buf += 8;
+		len -= 8;
+	}
 	while (len-- > 0)
-		crc = crc_table32[(crc ^ (*buf++)) & 0xff] ^ (crc >> 8);
+		crc = crc_table32[0][(crc ^ (*buf++)) & 0xff] ^ (crc >> 8);
 	return crc ^ 0xffffffff;
 }
 uae_u16 get_crc16 (void *vbuf, int len)
 {
 	uae_u8 *buf = (uae_u8*)vbuf;
 	uae_u16 crc;
-	if (!crc_table32[1])
+	if (!crc_table32[0][1])
 		make_crc_table();
 	crc = 0xffff;
 	while (len-- > 0)
@@ -108,7 +108,7 @@ uae_u16 customhack_get (struct customhack *ch, int hpos)
 static unsigned int n_consecutive_skipped = 0;
 static unsigned int total_skipped = 0;
 
-extern int cpu_last_stop_vpos, cpu_stopped_lines;
+extern int cpu_last_stop_vpos, cpu_stopped_lines, cpu_busywait;
 static int cpu_sleepmode, cpu_sleepmode_cnt;
 
 extern int vsync_activeheight, vsync_totalheight;
@@ -553,7 +553,7 @@ STATIC_INLINE int ecsshres(void)
 STATIC_INLINE int nodraw(void)
 {
 	struct amigadisplay *ad = &adisplays[0];
-	return !currprefs.cpu_memory_cycle_exact && ad->framecnt != 0;
+	return !currprefs.cpu_memory_cycle_exact && ad->framecnt != 0 && !warp_norender;
 }
 
 static int doflickerfix (void)
@@ -9916,8 +9916,8 @@ static void hsync_handler_post (bool onvsync)
 			if (sleeps_remaining < 0)
 				sleeps_remaining = 0;
 			/* really last line, just run the cpu emulation until whole vsync time has been used */
-			if (regs.stopped && currprefs.cpu_idle) {
-				// CPU in STOP state: sleep if enough time left.
+			if ((regs.stopped || cpu_busywait) && currprefs.cpu_idle) {
+				// CPU in STOP state or busy-waiting: sleep if enough time left.
 				frame_time_t rpt = read_processor_time ();
 				while (vsync_isdone(NULL) <= 0 && (int)vsyncmintime - (int)(rpt + vsynctimebase / 10) > 0 && (int)vsyncmintime - (int)rpt < vsynctimebase) {
 					maybe_process_pull_audio();
@@ -9949,7 +9949,7 @@ static void hsync_handler_post (bool onvsync)
 						frame_time_t rpt = read_processor_time ();
 						/* Extra time left? Do some extra CPU emulation */
 						if ((int)vsyncmintime - (int)rpt > 0) {
-							if (regs.stopped && currprefs.cpu_idle && sleeps_remaining > 0) {
+							if ((regs.stopped || cpu_busywait) && currprefs.cpu_idle && sleeps_remaining > 0) {
 								// STOP STATE: sleep.
 								cpu_sleep_millis(1);
 								sleeps_remaining--;
@@ -9964,7 +9964,7 @@ static void hsync_handler_post (bool onvsync)
 					}
 					if (!isvsync ()) {
 						// extra cpu emulation time if previous 10 lines without extra time.
-						if (!is_syncline && linecounter >= 10 && (!regs.stopped || !currprefs.cpu_idle)) {
+						if (!is_syncline && linecounter >= 10 && ((!regs.stopped && !cpu_busywait) || !currprefs.cpu_idle)) {
 							is_syncline = -10;
 							is_syncline_end = read_processor_time () + vsynctimeperline;
 							linecounter = 0;
@@ -10008,6 +10008,13 @@ static void hsync_handler_post (bool onvsync)
 		}
 	}
 
+	if (cpu_busywait) {
+		// busy-waiting line counts as stopped line for sleep mode
+		if (!regs.stopped && cpu_last_stop_vpos >= 0)
+			cpu_stopped_lines++;
+		cpu_busywait = 0;
+	}
+
 	if (!input_read_done)
 		inputdevice_hsync(false);
 
@@ -11667,6 +11674,12 @@ void check_prefs_changed_custom (void)
 			warpmode (changed_prefs.turbo_emulation);
 		}
 	}
+	if (currprefs.turbo_emulation_render != changed_prefs.turbo_emulation_render) {
+		currprefs.turbo_emulation_render = changed_prefs.turbo_emulation_render;
+		if (changed_prefs.turbo_emulation) {
+			warpmode (changed_prefs.turbo_emulation);
+		}
+	}
 	if (currprefs.turbo_emulation != changed_prefs.turbo_emulation)
 		warpmode (changed_prefs.turbo_emulation);
 	if (inputdevice_config_change_test ()) 
@@ -202,6 +202,7 @@ static const TCHAR help[] = {
 	_T("  Cl                    List currently found trainer addresses.\n")
 	_T("  D[idxzs <[max diff]>] Deep trainer. i=new value must be larger, d=smaller,\n")
 	_T("                        x = must be same, z = must be different, s = restart.\n")
+	_T("                        1, 2 or 4 after the mode selects byte, word or long size.\n")
 	_T("  W <addr> <values[.x] separated by space> Write into Amiga memory.\n")
 	_T("  W <addr> 'string'     Write into Amiga memory.\n")
 	_T("  Wf <addr> <endaddr> <bytes or string like above>, fill memory.\n")
@@ -212,7 +213,7 @@ static const TCHAR help[] = {
 	_T("  L <file> <addr> [<n>] Load a block of Amiga memory.\n")
 	_T("  S <file> <addr> <n>   Save a block of Amiga memory.\n")
 	_T("  s \"<string>\"/<values> [<addr>] [<length>]\n")
-	_T("                        Search for string/bytes.\n")
+	_T("                        Search for string/bytes, ?? matches any byte.\n")
 	_T("  T or Tt               Show exec tasks and their PCs.\n")
 	_T("  Td,Tl,Tr,Tp,Ts,TS,Ti,TO,TM,Tf Show devs, libs, resources, ports, semaphores,\n")
 	_T("                        residents, interrupts, doslist, memorylist, fsres.\n")
@@ -448,6 +449,13 @@ uae_u8 *get_real_address_debug(uaecptr addr)
 	}
 	return get_real_address(addr);
 }
+// host pointer for addr..addr+len-1 if it is directly addressable memory
+static uae_u8 *get_real_address_debug_range(uaecptr addr, uae_u32 len)
+{
+	if (debug_mmu_mode || !valid_address(addr, len))
+		return NULL;
+	return get_real_address(addr);
+}
 
 int debug_safe_addr (uaecptr addr, int size)
 {
@@ -2344,15 +2352,17 @@ static void listcheater(int mode, int size)
 		skip = 8;
 	for(i = 0; i < totaltrainers; i++) {
 		struct trainerstruct *ts = &trainerdata[i];
-		uae_u16 b;
+		uae_u32 b;
 
-		if (size) {
-			b = get_byte_debug (ts->addr);
-		} else {
+		if (size == 4) {
+			b = get_long_debug (ts->addr);
+		} else if (size == 2) {
 			b = get_word_debug (ts->addr);
+		} else {
+			b = get_byte_debug (ts->addr);
 		}
 		if (mode)
-			console_out_f (_T("%08X=%04X "), ts->addr, b);
+			console_out_f (_T("%08X=%0*X "), ts->addr, size * 2, b);
 		else
 			console_out_f (_T("%08X "), ts->addr);
 		if ((i % skip) == skip)
@@ -2360,6 +2370,22 @@ static void listcheater(int mode, int size)
 	}
 }
 
+static uae_u32 deepcheat_get (uaecptr addr, const uae_u8 *p, int size)
+{
+	if (p) {
+		if (size == 1)
+			return p[0];
+		if (size == 2)
+			return (p[0] << 8) | p[1];
+		return (p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+	}
+	if (size == 1)
+		return get_byte_debug (addr);
+	if (size == 2)
+		return get_word_debug (addr);
+	return get_long_debug (addr);
+}
+
 static void deepcheatsearch (TCHAR **c)
 {
 	static int first = 1;
@@ -2367,10 +2393,11 @@ static void deepcheatsearch (TCHAR **c)
 	static int memsize, memsize2;
 	uae_u8 *p1, *p2;
 	uaecptr addr, end;
-	int i, wasmodified, nonmodified;
+	int wasmodified, nonmodified;
 	static int size;
 	static int inconly, deconly, maxdiff;
 	int addrcnt, cnt;
+	bool aborted;
 	TCHAR v;
 
 	v = _totupper (**c);
@@ -2385,7 +2412,7 @@ static void deepcheatsearch (TCHAR **c)
 	if (**c)
 		(*c)++;
 	ignore_ws (c);
-	if ((**c) == '1' || (**c) == '2') {
+	if ((**c) == '1' || (**c) == '2' || (**c) == '4') {
 		size = **c - '0';
 		(*c)++;
 	}
@@ -2409,8 +2436,21 @@ static void deepcheatsearch (TCHAR **c)
 		p1 = memtmp;
 		addr = 0xffffffff;
 		while ((addr = nextaddr (addr, 0, &end, true)) != 0xffffffff) {
-			for (i = addr; i < end; i++)
-				*p1++ = get_byte_debug (i);
+			uaecptr a = addr;
+			while (a < end) {
+				uae_u32 len = ((a & ~0xffff) + 0x10000) - a;
+				if (len > end - a)
+					len = end - a;
+				uae_u8 *p = get_real_address_debug_range (a, len);
+				if (p) {
+					memcpy (p1, p, len);
+				} else {
+					for (uae_u32 i = 0; i < len; i++)
+						p1[i] = get_byte_debug (a + i);
+				}
+				p1 += len;
+				a += len;
+			}
 			addr = end - 1;
 		}
 		console_out (_T("Deep trainer first pass complete.\n"));
@@ -2427,59 +2467,76 @@ static void deepcheatsearch (TCHAR **c)
 	p2 = memtmp + memsize;
 	addrcnt = 0;
 	cnt = 0;
+	aborted = false;
 	addr = 0xffffffff;
-	while ((addr = nextaddr (addr, 0, NULL, true)) != 0xffffffff) {
-		uae_s32 b, b2;
-		int doremove = 0;
-		int addroff = addrcnt >> 3;
-		int addrmask ;
-
-		if (size == 1) {
-			b = (uae_s8)get_byte_debug (addr);
-			b2 = (uae_s8)p1[addrcnt];
-			addrmask = 1 << (addrcnt & 7);
-		} else {
-			b = (uae_s16)get_word_debug (addr);
-			b2 = (uae_s16)((p1[addrcnt] << 8) | p1[addrcnt + 1]);
-			addrmask = 3 << (addrcnt & 7);
-		}
+	while (!aborted && (addr = nextaddr (addr, 0, &end, true)) != 0xffffffff) {
+		int runcnt = addrcnt;
+		uaecptr chunk = 0xffffffff, chunkend = 0;
+		uae_u8 *p = NULL;
+		for (uaecptr a = addr; a + size <= end; a += size, addrcnt += size) {
+			int addroff = addrcnt >> 3;
+			int addrmask = ((1 << size) - 1) << (addrcnt & 7);
+			uae_s32 b, b2;
+			int doremove = 0;
+
+			// all candidates of this bitmap byte are already gone
+			if (!p2[addroff]) {
+				int skip = 8 - (addrcnt & 7) - size;
+				a += skip;
+				addrcnt += skip;
+				continue;
+			}
+			if (a < chunk || a >= chunkend) {
+				chunk = a;
+				chunkend = (a & ~0xffff) + 0x10000;
+				if (chunkend > end)
+					chunkend = end;
+				p = get_real_address_debug_range (chunk, chunkend - chunk);
+				if (iscancel (1)) {
+					console_out_f (_T("Aborted at %08X\n"), a);
+					aborted = true;
+					break;
+				}
+			}
+			uae_u32 val = deepcheat_get (a, p && a + size <= chunkend ? p + (a - chunk) : NULL, size);
+			uae_u32 prev = deepcheat_get (a, p1 + addrcnt, size);
+			if (size == 1) {
+				b = (uae_s8)val;
+				b2 = (uae_s8)prev;
+			} else if (size == 2) {
+				b = (uae_s16)val;
+				b2 = (uae_s16)prev;
+			} else {
+				b = (uae_s32)val;
+				b2 = (uae_s32)prev;
+			}
 
-		if (p2[addroff] & addrmask) {
-			if (wasmodified && !nonmodified) {
-				int diff = b - b2;
-				if (b == b2)
-					doremove = 1;
-				if (abs(diff) > maxdiff)
+			if (p2[addroff] & addrmask) {
+				if (wasmodified && !nonmodified) {
+					uae_s64 diff = (uae_s64)b - b2;
+					if (b == b2)
+						doremove = 1;
+					if (diff > maxdiff || diff < -maxdiff)
+						doremove = 1;
+					if (inconly && diff < 0)
+						doremove = 1;
+					if (deconly && diff > 0)
+						doremove = 1;
+				} else if (nonmodified && b == b2) {
 					doremove = 1;
-				if (inconly && diff < 0)
+				} else if (!wasmodified && b != b2) {
 					doremove = 1;
-				if (deconly && diff > 0)
-					doremove = 1;
-			} else if (nonmodified && b == b2) {
-				doremove = 1;
-			} else if (!wasmodified && b != b2) {
-				doremove = 1;
+				}
+				if (doremove)
+					p2[addroff] &= ~addrmask;
+				else
+					cnt++;
 			}
-			if (doremove)
-				p2[addroff] &= ~addrmask;
-			else
-				cnt++;
-		}
-		if (size == 1) {
-			p1[addrcnt] = b;
-			addrcnt++;
-		} else {
-			p1[addrcnt] = b >> 8;
-			p1[addrcnt + 1] = b >> 0;
-			addr = nextaddr (addr, 0, NULL, true);
-			if (addr == 0xffffffff)
-				break;
-			addrcnt += 2;
-		}
-		if  (iscancel (65536)) {
-			console_out_f (_T("Aborted at %08X\n"), addr);
-			break;
+			for (int i = 0; i < size; i++)
+				p1[addrcnt + i] = val >> ((size - 1 - i) * 8);
 		}
+		addrcnt = runcnt + (end - addr);
+		addr = end - 1;
 	}
 
 	console_out_f (_T("%d addresses found\n"), cnt);
@@ -2488,13 +2545,18 @@ static void deepcheatsearch (TCHAR **c)
 		cnt = 0;
 		addrcnt = 0;
 		addr = 0xffffffff;
-		while ((addr = nextaddr(addr, 0, NULL, true)) != 0xffffffff) {
-			int addroff = addrcnt >> 3;
-			int addrmask = (size == 1 ? 1 : 3) << (addrcnt & 7);
-			if (p2[addroff] & addrmask)
-				addcheater (addr, size);
-			addrcnt += size;
-			cnt++;
+		while ((addr = nextaddr(addr, 0, &end, false)) != 0xffffffff) {
+			int runcnt = addrcnt;
+			for (uaecptr a = addr; a + size <= end; a += size, addrcnt += size) {
+				int addroff = addrcnt >> 3;
+				int addrmask = ((1 << size) - 1) << (addrcnt & 7);
+				if (p2[addroff] & addrmask) {
+					addcheater (a, size);
+					cnt++;
+				}
+			}
+			addrcnt = runcnt + (end - addr);
+			addr = end - 1;
 		}
 		if (cnt > 0)
 			console_out (_T("\n"));
@@ -4996,10 +5058,22 @@ S_argh:
 	console_out (_T("Command needs more arguments!\n"));
 }
 
+static bool searchmem_match (uaecptr addr, const uae_u8 *p, int avail, const uae_u8 *ss, const uae_u8 *ssmask, int sslen, int stringmode)
+{
+	for (int i = 0; i < sslen; i++) {
+		uae_u8 b = i < avail ? p[i] : get_byte_debug (addr + i);
+		if (stringmode)
+			b = tolower (b);
+		if ((b & ssmask[i]) != ss[i])
+			return false;
+	}
+	return true;
+}
+
 static void searchmem (TCHAR **cc)
 {
-	int i, sslen, got, val, stringmode;
-	uae_u8 ss[256];
+	int sslen, got, val, stringmode;
+	uae_u8 ss[256], ssmask[256];
 	uae_u32 addr, endaddr;
 	TCHAR nc;
 
@@ -5010,19 +5084,28 @@ static void searchmem (TCHAR **cc)
 	if (**cc == '"') {
 		stringmode = 1;
 		(*cc)++;
-		while (**cc != '"' && **cc != 0) {
+		while (**cc != '"' && **cc != 0 && sslen < (int)sizeof ss) {
+			ssmask[sslen] = 0xff;
 			ss[sslen++] = tolower (**cc);
 			(*cc)++;
 		}
 		if (**cc != 0)
 			(*cc)++;
 	} else {
-		for (;;) {
+		while (sslen < (int)sizeof ss) {
 			if (**cc == 32 || **cc == 0)
 				break;
 			nc = _totupper (next_char (cc));
 			if (isspace (nc))
 				break;
+			// "??" matches any byte
+			if (nc == '?') {
+				if (**cc == '?')
+					(*cc)++;
+				ssmask[sslen] = 0;
+				ss[sslen++] = 0;
+				continue;
+			}
 			if (isdigit(nc))
 				val = nc - '0';
 			else
@@ -5041,6 +5124,7 @@ static void searchmem (TCHAR **cc)
 				val += nc - 'A' + 10;
 			if (val < 0 || val > 255)
 				return;
+			ssmask[sslen] = 0xff;
 			ss[sslen++] = (uae_u8)val;
 		}
 	}
@@ -5060,28 +5144,44 @@ static void searchmem (TCHAR **cc)
 	while ((addr = nextaddr (addr, endaddr, NULL, true)) != 0xffffffff) {
 		if (addr == endaddr)
 			break;
-		for (i = 0; i < sslen; i++) {
-			uae_u8 b = get_byte_debug (addr + i);
-			if (stringmode) {
-				if (tolower (b) != ss[i])
-					break;
+		// scan one 64k bank at a time, directly from host memory if possible
+		uaecptr chunkend = (addr & ~0xffff) + 0x10000;
+		if (endaddr && chunkend > endaddr)
+			chunkend = endaddr;
+		uae_u32 len = chunkend - addr;
+		uae_u8 *p = get_real_address_debug_range (addr, len);
+		bool full = false;
+		for (uae_u32 off = 0; off < len; off++) {
+			if (p) {
+				if (!stringmode && ssmask[0]) {
+					const uae_u8 *next = (const uae_u8*)memchr (p + off, ss[0], len - off);
+					if (!next)
+						break;
+					off = (uae_u32)(next - p);
+				}
+				if (!searchmem_match (addr + off, p + off, (int)(len - off), ss, ssmask, sslen, stringmode))
+					continue;
 			} else {
-				if (b != ss[i])
-					break;
+				if (!searchmem_match (addr + off, NULL, 0, ss, ssmask, sslen, stringmode))
+					continue;
 			}
-		}
-		if (i == sslen) {
 			got++;
-			console_out_f (_T(" %08X"), addr);
+			console_out_f (_T(" %08X"), addr + off);
 			if (got > 100) {
 				console_out (_T("\nMore than 100 results, aborting.."));
+				full = true;
 				break;
 			}
 		}
-		if  (iscancel (65536)) {
-			console_out_f (_T("Aborted at %08X\n"), addr);
+		if (full)
+			break;
+		if (iscancel (1)) {
+			console_out_f (_T("Aborted at %08X\n"), chunkend);
 			break;
 		}
+		if (!chunkend || chunkend == endaddr)
+			break;
+		addr = chunkend - 1;
 	}
 	if (!got)
 		console_out (_T("nothing found"));
@@ -152,6 +152,15 @@ struct debugsymbol
 };
 static struct debugsymbol **symbols;
 static int symbolcnt, symbolindex;
+// symbol indexes sorted by address, rebuilt on demand after symbols change
+static int *symbolsorted;
+static int symbolsortedcnt;
+static bool symbolsorted_valid;
+
+static void symbols_changed(void)
+{
+	symbolsorted_valid = false;
+}
 
 struct libname
 {
@@ -227,6 +236,10 @@ struct debugmemdata
 	uae_u16 flags;
 	uae_u8 unused_start;
 	uae_u8 unused_end;
+	// access types (DEBUGMEM_READ/WRITE/FETCH) that can't change state or fail anywhere in this page
+	uae_u8 fast;
+	// access types already found not to qualify since last state change
+	uae_u8 fastfail;
 	uae_u8 state[PAGE_SIZE];
 };
 
@@ -571,6 +584,7 @@ void debugmem_flushcache(uaecptr addr, int size)
 					dm->state[j] &= ~DEBUGMEM_WRITE_NOCACHEFLUSH;
 				}
 				dm->flags &= ~DEBUGMEM_WRITE_NOCACHEFLUSH;
+				dm->fast = dm->fastfail = 0;
 			}
 		}
 		return;
@@ -588,14 +602,63 @@ void debugmem_flushcache(uaecptr addr, int size)
 				continue;
 			dm->state[j] &= ~DEBUGMEM_WRITE_NOCACHEFLUSH;
 		}
+		dm->fast = dm->fastfail = 0;
 	}
 }
 
+static int debugmem_fastkind(int rwi)
+{
+	if (rwi == DEBUGMEM_READ)
+		return DEBUGMEM_READ;
+	if (rwi == DEBUGMEM_WRITE)
+		return DEBUGMEM_WRITE;
+	if (rwi == (DEBUGMEM_READ | DEBUGMEM_FETCH) && !debug_waiting)
+		return DEBUGMEM_FETCH;
+	return 0;
+}
+
+// mark page as fast for this access type if no byte in it can report or change state
+static void debugmem_setfast(struct debugmemdata *dm, int kind)
+{
+	if ((dm->fast | dm->fastfail) & kind)
+		return;
+	bool ok = !(dm->flags & DEBUGMEM_PARTIAL);
+	for (int i = 0; ok && i < PAGE_SIZE; i++) {
+		uae_u8 state = dm->state[i];
+		if (!(state & DEBUGMEM_INUSE))
+			ok = false;
+		else if (kind == DEBUGMEM_READ)
+			ok = (state & DEBUGMEM_READ) && (state & (DEBUGMEM_INITIALIZED | DEBUGMEM_WRITE));
+		else if (kind == DEBUGMEM_WRITE)
+			ok = (state & DEBUGMEM_WRITE) != 0;
+		else
+			ok = (state & (DEBUGMEM_READ | DEBUGMEM_FETCH | DEBUGMEM_INITIALIZED)) == (DEBUGMEM_READ | DEBUGMEM_FETCH | DEBUGMEM_INITIALIZED) && !(state & DEBUGMEM_WRITE);
+	}
+	if (ok)
+		dm->fast |= kind;
+	else
+		dm->fastfail |= kind;
+}
+
 static bool debugmem_func(uaecptr addr, int rwi, int size, uae_u32 val)
 {
 	bool ret = true;
 	uaecptr oaddr = addr;
 	struct debugmemdata *dmfirst = NULL;
+	int kind = debugmem_fastkind(rwi);
+	bool changed = false;
+	uaecptr pageaddr = addr >= debugmem_bank.start ? addr - debugmem_bank.start : addr;
+	bool onepage = (pageaddr & PAGE_SIZE_MASK) + size <= PAGE_SIZE;
+
+	// page already known to be clean for this access type: nothing to check or record
+	if (kind && onepage) {
+		struct debugmemdata *dm = dmd[pageaddr / PAGE_SIZE];
+		if (dm->fast & kind) {
+			if (kind == DEBUGMEM_WRITE)
+				dm->flags |= DEBUGMEM_WRITE_NOCACHEFLUSH;
+			return true;
+		}
+	}
 
 	if (debug_waiting && (rwi & DEBUGMEM_FETCH)) {
 		// first instruction?
@@ -662,12 +725,19 @@ static bool debugmem_func(uaecptr addr, int rwi, int size, uae_u32 val)
 			state &= ~(DEBUGMEM_WRITE | DEBUGMEM_WRITE_NOCACHEFLUSH);
 		if ((state | rwi) != state) {
 			//console_out_f(_T("addr %08x %d/%d (%02x -> %02x) PC=%08x\n"), addr, i, size, state, rwi, M68K_GETPC);
+			uae_u8 old = dm->state[offset];
 			dm->state[offset] |= rwi;
-			
+			if (dm->state[offset] != old) {
+				dm->fast = dm->fastfail = 0;
+				changed = true;
+			}
 		}
 		addr++;
 	}
 
+	if (kind && onepage && !changed)
+		debugmem_setfast(dmfirst, kind);
+
 	return ret;
 }
 
@@ -962,6 +1032,7 @@ static struct debugmemallocs *debugmem_allocate(uae_u32 size, uae_u32 flags, uae
 			dm2->flags |= DEBUGMEM_STARTBLOCK;
 		}
 		memset(dm2->state, ((flags & DEBUGMEM_INITIALIZED) ? DEBUGMEM_INITIALIZED : 0) | DEBUGMEM_INUSE, PAGE_SIZE);
+		dm2->fast = dm2->fastfail = 0;
 		uae_u8 filler = (flags & DEBUGMEM_INITIALIZED) ? 0x00 : 0x99;
 		memset(debugmem_bank.baseaddr + (offset + startoffset + j) * PAGE_SIZE, filler, PAGE_SIZE);
 		if (j == (size + PAGE_SIZE - 1) / PAGE_SIZE - 1) {
@@ -1370,6 +1441,7 @@ static void parse_stabs(void)
 									ds->name = my_strdup(stripname);
 									ds->value = addr;
 									ds->flags = mode == mode > 'Z' ? SYMBOL_LOCAL : SYMBOL_GLOBAL;
+									symbols_changed();
 								}
 							}
 							if (ds) {
@@ -1501,6 +1573,7 @@ static void addsimplesymbol(const TCHAR *name, uae_u32 v, int type, int flags, i
 			ds->segment = segmentid;
 			if (symbolindex >= symbolcnt)
 				symbolcnt = symbolindex + 1;
+			symbols_changed();
 			return;
 		}
 	}
@@ -1760,6 +1833,7 @@ static uaecptr loaddebugmemhunkfile(uae_u8 *p, uae_u32 len, uae_u32 *parentidp)
 					ds->value = gl(p) + hunks[hunkcnt]->start + 8 + debugmem_bank.start;
 					ds->allocid = hunks[hunkcnt]->id;
 					ds->section = hunks[hunkcnt];
+					symbols_changed();
 					ds->flags = SYMBOL_GLOBAL;
 					p += 4;
 					symcnt++;
@@ -3145,6 +3219,7 @@ void debugmem_addsegs(TrapContext *ctx, uaecptr seg, uaecptr name, uae_u32 lock,
 						fileoffset += 4 * size;
 						ds->value = gl(&file[fileoffset]) + seg + 4;
 						ds->segment = segmentid;
+						symbols_changed();
 						ds->section = dm;
 						fileoffset += 4;
 						symcnt++;
@@ -3356,6 +3431,7 @@ void debugmem_add_symbol(uae_u32 value, uaecptr aname)
 			ds->type = SYMBOL_GLOBAL;
 			if (symbolindex > symbolcnt)
 				symbolcnt = symbolindex;
+			symbols_changed();
 			return;
 		}
 	}
@@ -3491,6 +3567,7 @@ void debugmem_init(bool initmem)
 	codefilecnt = 0;
 	symbolcnt = 0;
 	symbolindex = 0;
+	symbols_changed();
 	executable_last_segment = 0;
 	segtrackermax = 0;
 	segtrackerindex = 0;
@@ -3603,14 +3680,53 @@ bool debugmem_get_symbol_value(const TCHAR *name, uae_u32 *valp)
 	return false;
 }
 
+static int symbols_sort_cmp(const void *a, const void *b)
+{
+	int ia = *(const int*)a;
+	int ib = *(const int*)b;
+	uae_u32 va = symbols[ia]->value;
+	uae_u32 vb = symbols[ib]->value;
+	if (va != vb)
+		return va < vb ? -1 : 1;
+	return ia - ib;
+}
+
+static void symbols_sort(void)
+{
+	if (!symbolsorted)
+		symbolsorted = xmalloc(int, MAX_DEBUGSYMS);
+	symbolsortedcnt = 0;
+	for (int i = 0; i < symbolcnt; i++) {
+		symbolsorted[symbolsortedcnt++] = i;
+	}
+	qsort(symbolsorted, symbolsortedcnt, sizeof(int), symbols_sort_cmp);
+	symbolsorted_valid = true;
+}
+
 int debugmem_get_symbol(uaecptr addr, TCHAR *out, int maxsize)
 {
 	if (out)
 		out[0] = 0;
 	int found = 0;
-	for (int i = 0; i < symbolcnt; i++) {
+	if (!symbolcnt)
+		return 0;
+	if (!symbolsorted_valid)
+		symbols_sort();
+	// first sorted entry with value >= addr
+	int lo = 0, hi = symbolsortedcnt;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		if (symbols[symbolsorted[mid]]->value < addr)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	for (int j = lo; j < symbolsortedcnt; j++) {
+		int i = symbolsorted[j];
 		struct debugsymbol *ds = symbols[i];
-		if (ds->allocid && ds->value == addr) {
+		if (ds->value != addr)
+			break;
+		if (ds->allocid) {
 			if (out) {
 				TCHAR txt[256];
 				_tcscpy(txt, ds->name);
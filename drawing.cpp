@@ -351,12 +351,43 @@ static void reset_decision_table (void)
 	}
 }
 
+/* Render-free warp mode: chipset keeps making all line decisions but
+ * only one frame every turbo_emulation_render seconds (or on request)
+ * is drawn. */
+bool warp_norender;
+static frame_time_t warp_render_time;
+static int warp_render_secs;
+static bool warp_render_requested;
+
+void warp_render_request(void)
+{
+	warp_render_requested = true;
+}
+
+static bool warp_render_frame(void)
+{
+	frame_time_t t = read_processor_time();
+	if ((int)(t - warp_render_time) >= syncbase || (int)(t - warp_render_time) < 0) {
+		warp_render_time = t;
+		warp_render_secs++;
+	}
+	if (warp_render_requested || warp_render_secs >= currprefs.turbo_emulation_render) {
+		warp_render_requested = false;
+		warp_render_secs = 0;
+		return true;
+	}
+	return false;
+}
+
 static void count_frame(int monid)
 {
 	struct amigadisplay *ad = &adisplays[monid];
 	ad->framecnt++;
 	if (ad->framecnt >= currprefs.gfx_framerate || currprefs.monitoremu == MONITOREMU_A2024)
 		ad->framecnt = 0;
+	warp_norender = currprefs.turbo_emulation && currprefs.turbo_emulation_render > 0;
+	if (warp_norender)
+		ad->framecnt = warp_render_frame() ? 0 : 1;
 	if (ad->inhibit_frame)
 		ad->framecnt = 1;
 }
@@ -4404,7 +4435,7 @@ void vsync_handle_redraw(int long_field, int lof_changed, uae_u16 bplcon0p, uae_
 
 		if (ad->framecnt == 0) {
 			init_drawing_frame();
-		} else if (currprefs.cpu_memory_cycle_exact) {
+		} else if (currprefs.cpu_memory_cycle_exact || warp_norender) {
 			init_hardware_for_drawing_frame();
 		}
 	} else {
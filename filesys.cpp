@@ -4473,6 +4473,8 @@ static int exalldo(TrapContext *ctx, uaecptr exalldata, uae_u32 exalldatasize, u
 	int fsdb_can = fsdb_cando (unit);
 	uae_u16 uid = 0, gid = 0;
 	char *x = NULL, *comment = NULL;
+	uae_u8 *buf = NULL;
+	int entrysize;
 	int ret = 0;
 
 	memset (&statbuf, 0, sizeof statbuf);
@@ -4544,45 +4546,47 @@ static int exalldo(TrapContext *ctx, uaecptr exalldata, uae_u32 exalldatasize, u
 		trap_get_long(ctx, control + 4), trap_get_long(ctx, control + 0), exp, xs, aino->dir ? _T(" [DIR]") : _T(""));
 #endif
 
-	trap_put_long(ctx, exp, exp + size + size2); /* ed_Next */
+	/* build the entry on the host side and copy it with one transfer */
+	entrysize = size + size2;
+	buf = xcalloc(uae_u8, entrysize);
+	if (!buf)
+		goto end;
+	put_long_host(buf, exp + entrysize); /* ed_Next */
 	if (type >= 1) {
-		trap_put_long(ctx, exp + 4, exp + size2);
-		for (i = 0; i <= strlen (x); i++) {
-			trap_put_byte(ctx, exp + size2, x[i]);
-			size2++;
-		}
+		put_long_host(buf + 4, exp + size2);
+		memcpy(buf + size2, x, strlen (x) + 1);
+		size2 += strlen (x) + 1;
 	}
 	if (type >= 2)
-		trap_put_long(ctx, exp + 8, entrytype);
+		put_long_host(buf + 8, entrytype);
 	if (type >= 3)
-		trap_put_long(ctx, exp + 12, statbuf.size > MAXFILESIZE32 ? MAXFILESIZE32 : statbuf.size);
+		put_long_host(buf + 12, statbuf.size > MAXFILESIZE32 ? MAXFILESIZE32 : statbuf.size);
 	if (type >= 4)
-		trap_put_long(ctx, exp + 16, flags);
+		put_long_host(buf + 16, flags);
 	if (type >= 5) {
-		trap_put_long(ctx, exp + 20, days);
-		trap_put_long(ctx, exp + 24, mins);
-		trap_put_long(ctx, exp + 28, ticks);
+		put_long_host(buf + 20, days);
+		put_long_host(buf + 24, mins);
+		put_long_host(buf + 28, ticks);
 	}
 	if (type >= 6) {
-		trap_put_long(ctx, exp + 32, exp + size2);
-		trap_put_byte(ctx, exp + size2, strlen (comment));
-		for (i = 0; i <= strlen (comment); i++) {
-			trap_put_byte(ctx, exp + size2, comment[i]);
-			size2++;
-		}
+		put_long_host(buf + 32, exp + size2);
+		memcpy(buf + size2, comment, strlen (comment) + 1);
+		size2 += strlen (comment) + 1;
 	}
 	if (type >= 7) {
-		trap_put_word(ctx, exp + 36, uid);
-		trap_put_word(ctx, exp + 38, gid);
+		put_word_host(buf + 36, uid);
+		put_word_host(buf + 38, gid);
 	}
 	if (type >= 8) {
-		trap_put_long(ctx, exp + 40, statbuf.size >> 32);
-		trap_put_long(ctx, exp + 44, (uae_u32)statbuf.size);
+		put_long_host(buf + 40, statbuf.size >> 32);
+		put_long_host(buf + 44, (uae_u32)statbuf.size);
 	}
+	trap_put_bytes(ctx, buf, exp, entrysize);
 
 	trap_put_long(ctx, control + 0, trap_get_long(ctx, control + 0) + 1);
 	ret = 1;
 end:
+	xfree (buf);
 	xfree (x);
 	xfree (comment);
 	return ret;
@@ -45,6 +45,7 @@ static int using_prefetch, using_indirect, using_mmu;
 static int using_prefetch_020, using_ce020;
 static int using_exception_3;
 static int using_ce;
+static int using_direct_ce;
 static int using_tracer;
 static int using_waitstates;
 static int using_simple_cycles;
@@ -4423,6 +4424,13 @@ static void movem_ex3(int write)
 }
 
 
+// generic cores without indirect memory access: MOVEM and MOVE16 can
+// access RAM directly if whole transfer is inside single direct access bank.
+static bool using_direct_bulk(void)
+{
+	return cpu_generic && using_indirect <= 0 && !using_mmu && !using_test;
+}
+
 static void genmovemel(uae_u16 opcode)
 {
 	char getcode[100];
@@ -4452,6 +4460,35 @@ static void genmovemel(uae_u16 opcode)
 	} else if (using_mmu == 68040) {
 		movem_mmu040 (getcode, size, false, table68k[opcode].dmode == Aipi, false, opcode);
 	} else {
+		if (using_direct_bulk()) {
+			char directcode[100];
+			if (size == 4) {
+				strcpy(directcode, "do_get_mem_long((uae_u32*)movemp)");
+			} else {
+				strcpy(directcode, "(uae_s32)(uae_s16)do_get_mem_word((uae_u16*)movemp)");
+			}
+			out("uae_u32 movemsize = (movem_count[dmask] + movem_count[amask]) * %d;\n", size);
+			out("uae_u8 *movemp = memory_get_direct_r(srca, movemsize);\n");
+			out("if (movemp) {\n");
+			out("while (dmask) {\n");
+			out("m68k_dreg(regs, movem_index1[dmask]) = %s;\n", directcode);
+			if (cpu_level <= 3) {
+				addcycles000_nonce(cpu_level <= 1 ? size * 2 : 4);
+			}
+			out("movemp += %d;\n", size);
+			out("dmask = movem_next[dmask];\n");
+			out("}\n");
+			out("while (amask) {\n");
+			out("m68k_areg(regs, movem_index1[amask]) = %s;\n", directcode);
+			if (cpu_level <= 3) {
+				addcycles000_nonce(cpu_level <= 1 ? size * 2 : 4);
+			}
+			out("movemp += %d;\n", size);
+			out("amask = movem_next[amask];\n");
+			out("}\n");
+			out("srca += movemsize;\n");
+			out("} else {\n");
+		}
 		out("while (dmask) {\n");
 		out("m68k_dreg(regs, movem_index1[dmask]) = %s;\n", getcode);
 		if (cpu_level <= 3) {
@@ -4470,6 +4507,9 @@ static void genmovemel(uae_u16 opcode)
 		out("srca += %d;\n", size);
 		out("amask = movem_next[amask];\n");
 		out("}\n");
+		if (using_direct_bulk()) {
+			out("}\n");
+		}
 		if (table68k[opcode].dmode == Aipi) {
 			out("m68k_areg(regs, dstreg) = srca;\n");
 		}
@@ -4560,13 +4600,15 @@ static void genmovemel_ce(uae_u16 opcode)
 
 static void genmovemle(uae_u16 opcode)
 {
-	char putcode[100];
+	char putcode[100], directcode[100];
 	int size = table68k[opcode].size == sz_long ? 4 : 2;
 
 	if (size == 4) {
 		sprintf(putcode, "%s(srca", dstld);
+		strcpy(directcode, "do_put_mem_long((uae_u32*)movemp");
 	} else {
 		sprintf(putcode, "%s(srca", dstwd);
+		strcpy(directcode, "do_put_mem_word((uae_u16*)movemp");
 	}
 	if (!using_simple_cycles && !do_always_dynamic_cycles) {
 		if (size == 4)
@@ -4598,6 +4640,34 @@ static void genmovemle(uae_u16 opcode)
 			if (!using_mmu) {
 				out("int type = %d;\n", cpu_level > 1);
 			}
+			if (using_direct_bulk()) {
+				out("uae_u32 movemsize = (movem_count[dmask] + movem_count[amask]) * %d;\n", size);
+				out("uae_u8 *movemp = memory_get_direct_w(srca - movemsize, movemsize);\n");
+				out("if (movemp) {\n");
+				out("movemp += movemsize;\n");
+				out("while (amask) {\n");
+				out("movemp -= %d;\n", size);
+				out("if (!type || movem_index2[amask] != dstreg) {\n");
+				out("%s, m68k_areg(regs, movem_index2[amask]));\n", directcode);
+				out("} else {\n");
+				out("%s, m68k_areg(regs, movem_index2[amask]) - %d);\n", directcode, size);
+				out("}\n");
+				if (cpu_level <= 3) {
+					addcycles000_nonce(cpu_level <= 1 ? size * 2 : 4);
+				}
+				out("amask = movem_next[amask];\n");
+				out("}\n");
+				out("while (dmask) {\n");
+				out("movemp -= %d;\n", size);
+				out("%s, m68k_dreg(regs, movem_index2[dmask]));\n", directcode);
+				if (cpu_level <= 3) {
+					addcycles000_nonce(cpu_level <= 1 ? size * 2 : 4);
+				}
+				out("dmask = movem_next[dmask];\n");
+				out("}\n");
+				out("srca -= movemsize;\n");
+				out("} else {\n");
+			}
 			out("while (amask) {\n");
 			out("srca -= %d;\n", size);
 
@@ -4629,9 +4699,34 @@ static void genmovemle(uae_u16 opcode)
 			check_bus_error("src", 0, 1, table68k[opcode].size, "m68k_dreg(regs, movem_index2[dmask])", 1, 0);
 			out("dmask = movem_next[dmask];\n");
 			out("}\n");
+			if (using_direct_bulk()) {
+				out("}\n");
+			}
 			out("m68k_areg(regs, dstreg) = srca;\n");
 		} else {
 			out("uae_u16 dmask = mask & 0xff, amask = (mask >> 8) & 0xff;\n");
+			if (using_direct_bulk()) {
+				out("uae_u32 movemsize = (movem_count[dmask] + movem_count[amask]) * %d;\n", size);
+				out("uae_u8 *movemp = memory_get_direct_w(srca, movemsize);\n");
+				out("if (movemp) {\n");
+				out("while (dmask) {\n");
+				out("%s, m68k_dreg(regs, movem_index1[dmask]));\n", directcode);
+				if (cpu_level <= 3) {
+					addcycles000_nonce(cpu_level <= 1 ? size * 2 : 4);
+				}
+				out("movemp += %d;\n", size);
+				out("dmask = movem_next[dmask];\n");
+				out("}\n");
+				out("while (amask) {\n");
+				out("%s, m68k_areg(regs, movem_index1[amask]));\n", directcode);
+				if (cpu_level <= 3) {
+					addcycles000_nonce(cpu_level <= 1 ? size * 2 : 4);
+				}
+				out("movemp += %d;\n", size);
+				out("amask = movem_next[amask];\n");
+				out("}\n");
+				out("} else {\n");
+			}
 			out("while (dmask) {\n");
 			out("%s, m68k_dreg(regs, movem_index1[dmask]));\n", putcode);
 			if (cpu_level <= 3) {
@@ -4650,6 +4745,9 @@ static void genmovemle(uae_u16 opcode)
 			out("srca += %d;\n", size);
 			out("amask = movem_next[amask];\n");
 			out("}\n");
+			if (using_direct_bulk()) {
+				out("}\n");
+			}
 		}
 		if (!next_level_040_to_030())
 			next_level_020_to_010();
@@ -4659,6 +4757,29 @@ static void genmovemle(uae_u16 opcode)
 	get_prefetch_020();
 }
 
+static void genmove16(const char *mems, const char *memd)
+{
+	if (using_direct_bulk()) {
+		out("uae_u8 *move16s = memory_get_direct_r(%s, 16);\n", mems);
+		out("uae_u8 *move16d = memory_get_direct_w(%s, 16);\n", memd);
+		out("if (move16s && move16d) {\n");
+		out("memmove(move16d, move16s, 16);\n");
+		out("} else {\n");
+	}
+	out("uae_u32 v[4];\n");
+	out("v[0] = %s(%s);\n", srcl, mems);
+	out("v[1] = %s(%s + 4);\n", srcl, mems);
+	out("v[2] = %s(%s + 8);\n", srcl, mems);
+	out("v[3] = %s(%s + 12);\n", srcl, mems);
+	out("%s(%s, v[0]);\n", dstl, memd);
+	out("%s(%s + 4, v[1]);\n", dstl, memd);
+	out("%s(%s + 8, v[2]);\n", dstl, memd);
+	out("%s(%s + 12, v[3]);\n", dstl, memd);
+	if (using_direct_bulk()) {
+		out("}\n");
+	}
+}
+
 static void genmovemle_ce (uae_u16 opcode)
 {
 	int size = table68k[opcode].size == sz_long ? 4 : 2;
@@ -5224,6 +5345,29 @@ static void resetvars (void)
 		}
 	}
 
+	if (using_direct_ce) {
+		// cycle-exact without CPU tracer: memory access functions are known at compile time
+		if (using_ce020 == 1) {
+			srcli = "get_long_ce020_prefetch";
+			srcwi = "get_word_ce020_prefetch";
+			srcl = "get_long_ce020";
+			dstl = "put_long_ce020";
+			srcw = "get_word_ce020";
+			dstw = "put_word_ce020";
+			srcb = "get_byte_ce020";
+			dstb = "put_byte_ce020";
+		} else if (using_ce) {
+			prefetch_word = "get_word_ce000_prefetch_direct";
+			srcwi = "get_wordi_ce000";
+			srcl = "get_long_ce000";
+			dstl = "put_long_ce000";
+			srcw = "get_word_ce000";
+			dstw = "put_word_ce000";
+			srcb = "get_byte_ce000";
+			dstb = "put_byte_ce000";
+		}
+	}
+
 	if (using_test) {
 		prefetch_word = "get_word_test_prefetch";
 		srcwi = "get_wordi_test";
@@ -8970,15 +9114,7 @@ bccl_not68020:
 					out("get_move16_mmu (mems, v);\n");
 					out("put_move16_mmu (memd, v);\n");
 				} else {
-					out("uae_u32 v[4];\n");
-					out("v[0] = %s(mems);\n", srcl);
-					out("v[1] = %s(mems + 4);\n", srcl);
-					out("v[2] = %s(mems + 8);\n", srcl);
-					out("v[3] = %s(mems + 12);\n", srcl);
-					out("%s(memd , v[0]);\n", dstl);
-					out("%s(memd + 4, v[1]);\n", dstl);
-					out("%s(memd + 8, v[2]);\n", dstl);
-					out("%s(memd + 12, v[3]);\n", dstl);
+					genmove16("mems", "memd");
 				}
 				out("if (srcreg != dstreg)\n");
 				out("m68k_areg(regs, srcreg) += 16;\n");
@@ -8997,15 +9133,7 @@ bccl_not68020:
 				} else {
 					out("memsa &= ~15;\n");
 					out("memda &= ~15;\n");
-					out("uae_u32 v[4];\n");
-					out("v[0] = %s(memsa);\n", srcl);
-					out("v[1] = %s(memsa + 4);\n", srcl);
-					out("v[2] = %s(memsa + 8);\n", srcl);
-					out("v[3] = %s(memsa + 12);\n", srcl);
-					out("%s(memda , v[0]);\n", dstl);
-					out("%s(memda + 4, v[1]);\n", dstl);
-					out("%s(memda + 8, v[2]);\n", dstl);
-					out("%s(memda + 12, v[3]);\n", dstl);
+					genmove16("memsa", "memda");
 				}
 				if ((opcode & 0xfff8) == 0xf600)
 					out("m68k_areg(regs, srcreg) += 16;\n");
@@ -9617,8 +9745,8 @@ static void generate_cpu (int id, int mode)
 	}
 
 	postfix = id;
-	if (id == 0 || id == 11 || id == 13 ||
-		id == 20 || id == 21 || id == 22 || id == 23 || id == 24 ||
+	if (id == 0 || id == 11 || id == 13 || id == 15 ||
+		id == 20 || id == 21 || id == 22 || id == 23 || id == 24 || id == 26 ||
 		id == 31 || id == 32 || id == 33 || id == 34 || id == 35 ||
 		id == 40 || id == 50) {
 		if (generate_stbl)
@@ -9643,6 +9771,7 @@ static void generate_cpu (int id, int mode)
 	xfc_postfix = "";
 	using_simple_cycles = 0;
 	using_indirect = 0;
+	using_direct_ce = 0;
 	cpu_generic = false;
 	need_special_fixup = 0;
 	need_exception_oldpc = 0;
@@ -9659,12 +9788,13 @@ static void generate_cpu (int id, int mode)
 			for (rp = 0; rp < nr_cpuop_funcs; rp++)
 				opcode_next_clev[rp] = cpu_level;
 		}
-	} else if (id == 13 || id == 14) { // 13 = 68010 cycle-exact, 14 = 68000 cycle-exact
-		cpu_level = id == 13 ? 1 : 0;
+	} else if (id >= 13 && id <= 16) { // 13 = 68010 cycle-exact, 14 = 68000 cycle-exact, 15/16 = 13/14 with direct memory access
+		cpu_level = (id & 1) ? 1 : 0;
 		using_prefetch = 1;
 		using_exception_3 = 1;
 		using_ce = 1;
-		if (id == 13) {
+		using_direct_ce = id >= 15;
+		if (id == 13 || id == 15) {
 			read_counts();
 			for (rp = 0; rp < nr_cpuop_funcs; rp++)
 				opcode_next_clev[rp] = cpu_level;
@@ -9675,9 +9805,10 @@ static void generate_cpu (int id, int mode)
 		read_counts();
 		for (rp = 0; rp < nr_cpuop_funcs; rp++)
 			opcode_next_clev[rp] = cpu_level;
-	} else if (id == 21) { // 68020 cycle-exact
+	} else if (id == 21 || id == 26) { // 68020 cycle-exact, 26 = 21 with direct memory access
 		cpu_level = 2;
 		using_ce020 = 1;
+		using_direct_ce = id == 26;
 		using_prefetch_020 = 1;
 		// timing tables are from 030 which has 2
 		// clock memory accesses, 68020 has 3 clock
@@ -9850,7 +9981,7 @@ int main(int argc, char *argv[])
 	generate_includes(stblfile, 0);
 
 	for (int i = 0; i <= 55; i++) {
-		if ((i >= 6 && i < 11) || (i > 14 && i < 20) || (i > 25 && i < 31) || (i > 35 && i < 40))
+		if ((i >= 6 && i < 11) || (i > 16 && i < 20) || (i > 26 && i < 31) || (i > 35 && i < 40))
 			continue;
 		generate_stbl = 1;
 		generate_cpu (i, 0);
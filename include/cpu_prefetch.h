@@ -419,6 +419,12 @@ STATIC_INLINE uae_u32 get_word_ce000_prefetch (int o)
 	regs.irc = regs.read_buffer = regs.db = x_get_iword (o);
 	return v;
 }
+STATIC_INLINE uae_u32 get_word_ce000_prefetch_direct (int o)
+{
+	uae_u32 v = regs.irc;
+	regs.irc = regs.read_buffer = regs.db = get_wordi_ce000 (o);
+	return v;
+}
 
 STATIC_INLINE void put_long_ce000 (uaecptr addr, uae_u32 v)
 {
@@ -318,6 +318,9 @@ enum nln_how {
 	nln_lower_black_always
 };
 
+extern bool warp_norender;
+extern void warp_render_request(void);
+
 extern void hsync_record_line_state (int lineno, enum nln_how, int changed);
 extern void vsync_handle_redraw (int long_field, int lof_changed, uae_u16, uae_u16, bool drawlines);
 extern bool vsync_handle_check (void);
@@ -358,6 +358,7 @@ extern int jsem_iskbdjoy (int port, const struct uae_prefs *p);
 extern int inputdevice_uaelib (const TCHAR *, const TCHAR *);
 extern int inputdevice_uaelib(const TCHAR *s, int parm, int max, bool autofire);
 extern int handle_custom_event (const TCHAR *custom, int append);
+extern int inputdevice_get_frame(void);
 extern int inputdevice_geteventid(const TCHAR *s);
 
 extern int inputdevice_testread (int*, int*, int*, bool);
@@ -782,6 +782,8 @@ STATIC_INLINE void put_pointer (uaecptr addr, void *v)
 bool real_address_allowed(void);
 uae_u8 *memory_get_real_address(uaecptr);
 int memory_valid_address(uaecptr, uae_u32);
+uae_u8 *memory_get_direct_r(uaecptr, uae_u32);
+uae_u8 *memory_get_direct_w(uaecptr, uae_u32);
 
 STATIC_INLINE uae_u8 *get_real_address (uaecptr addr)
 {
@@ -45,6 +45,7 @@ extern const int imm8_table[];
 extern int movem_index1[256];
 extern int movem_index2[256];
 extern int movem_next[256];
+extern int movem_count[256];
 
 #ifdef FPUEMU
 extern int fpp_movem_index1[256];
@@ -801,18 +802,21 @@ extern const struct cputbl op_smalltbl_43[];
 extern const struct cputbl op_smalltbl_53[];
 extern const struct cputbl op_smalltbl_20[]; // prefetch
 extern const struct cputbl op_smalltbl_21[]; // CE
+extern const struct cputbl op_smalltbl_26[]; // CE, direct memory access
 /* 68010 */
 extern const struct cputbl op_smalltbl_4[];
 extern const struct cputbl op_smalltbl_44[];
 extern const struct cputbl op_smalltbl_54[];
 extern const struct cputbl op_smalltbl_11[]; // prefetch
 extern const struct cputbl op_smalltbl_13[]; // CE
+extern const struct cputbl op_smalltbl_15[]; // CE, direct memory access
 /* 68000 */
 extern const struct cputbl op_smalltbl_5[];
 extern const struct cputbl op_smalltbl_45[];
 extern const struct cputbl op_smalltbl_55[];
 extern const struct cputbl op_smalltbl_12[]; // prefetch
 extern const struct cputbl op_smalltbl_14[]; // CE
+extern const struct cputbl op_smalltbl_16[]; // CE, direct memory access
 
 extern cpuop_func *cpufunctbl[65536] ASM_SYM_FOR_FUNC ("cpufunctbl");
 
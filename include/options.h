@@ -611,6 +611,7 @@ struct uae_prefs {
 	bool uaeserial;
 	int catweasel;
 	int cpu_idle;
+	bool cpu_idle_busywait;
 	int ppc_cpu_idle;
 	bool cpu_cycle_exact;
 	int cpu_clock_multiplier;
@@ -629,6 +630,7 @@ struct uae_prefs {
 	bool rom_readwrite;
 	int turbo_emulation;
 	int turbo_emulation_limit;
+	int turbo_emulation_render;
 	bool headless;
 	int filesys_limit;
 	int filesys_max_name;
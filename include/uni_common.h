@@ -61,6 +61,8 @@ typedef uint16_t uni_ushort;
 
 typedef int (UNICALL *uni_version_function)();
 typedef void * (UNICALL *uni_resolve_function)(uni_ulong ptr);
+// returns NULL unless the whole range is directly accessible (no copy needed)
+typedef void * (UNICALL *uni_resolve_range_function)(uni_ulong ptr, uni_ulong size);
 typedef const char * (UNICALL *uni_uae_version_function)(void);
 
 struct uni {
@@ -3205,6 +3205,42 @@ static void joymousecounter (int joy)
 
 static int inputread;
 
+// host time between device polls, worst case latency added by polling
+static frame_time_t input_poll_last;
+static int input_poll_max;
+static uae_s64 input_poll_sum;
+static int input_poll_cnt;
+
+static void input_poll_stats(void)
+{
+	frame_time_t t = read_processor_time();
+	if (input_poll_last) {
+		int gap = (int)(t - input_poll_last);
+		// ignore pauses and other stops
+		if (gap >= 0 && gap < syncbase) {
+			input_poll_sum += gap;
+			input_poll_cnt++;
+			if (gap > input_poll_max)
+				input_poll_max = gap;
+		}
+	}
+	input_poll_last = t;
+}
+
+static void input_poll_stats_log(void)
+{
+	if (input_poll_cnt > 0 && syncbase > 0) {
+		write_log(_T("Input polls: %d, average interval %d us, max %d us\n"),
+			input_poll_cnt,
+			(int)(input_poll_sum * 1000000 / input_poll_cnt / syncbase),
+			(int)((uae_s64)input_poll_max * 1000000 / syncbase));
+	}
+	input_poll_last = 0;
+	input_poll_max = 0;
+	input_poll_sum = 0;
+	input_poll_cnt = 0;
+}
+
 static void inputdevice_read(void)
 {
 //	if ((inputdevice_logging & (2 | 4)))
@@ -3217,6 +3253,7 @@ static void inputdevice_read(void)
 		got2 = 1;
 	}
 	if (inputread <= 0) {
+		input_poll_stats();
 		idev[IDTYPE_MOUSE].read();
 		idev[IDTYPE_JOYSTICK].read();
 		idev[IDTYPE_KEYBOARD].read();
@@ -3735,10 +3772,32 @@ struct delayed_event
 	TCHAR *event_string;
 	int delay;
 	int append;
+	// "at": fire at absolute input frame/line instead of counting delay down
+	bool at;
+	int frame, line;
 	struct delayed_event *next;
 };
 static struct delayed_event *delayed_events;
 
+static struct delayed_event *get_delayed_event(void)
+{
+	struct delayed_event *de = delayed_events;
+	while (de) {
+		if (de->delay < 0)
+			return de;
+		de = de->next;
+	}
+	de = xcalloc (delayed_event, 1);
+	de->next = delayed_events;
+	delayed_events = de;
+	return de;
+}
+
+int inputdevice_get_frame(void)
+{
+	return input_frame;
+}
+
 int handle_custom_event (const TCHAR *custom, int append)
 {
 	TCHAR *p, *buf, *nextp;
@@ -3783,6 +3842,29 @@ int handle_custom_event (const TCHAR *custom, int append)
 			}
 		}
 		//write_log (L"-> '%s'\n", p);
+		if (!_tcsnicmp (p, _T("at "), 3)) {
+			// at <frame> [<line>]: run the rest at this emulated position
+			TCHAR *next;
+			int frame = _tcstol(p + 3, &next, 10);
+			int line = 0;
+			while (*next == ' ')
+				next++;
+			if (_istdigit(*next)) {
+				line = _tcstol(next, &next, 10);
+				while (*next == ' ')
+					next++;
+			}
+			if (!p2)
+				p2 = next;
+			struct delayed_event *de = get_delayed_event();
+			de->delay = 1;
+			de->append = 0;
+			de->at = true;
+			de->frame = frame;
+			de->line = line;
+			de->event_string = my_strdup(p2);
+			break;
+		}
 		if (!_tcsnicmp (p, _T("delay "), 6) || !_tcsnicmp (p, _T("vdelay "), 7) || !_tcsnicmp (p, _T("hdelay "), 7) || adddelay) {
 			TCHAR *next = NULL;
 			int delay = -1;
@@ -3812,24 +3894,11 @@ int handle_custom_event (const TCHAR *custom, int append)
 					else
 						p2 = _tcschr(next, ' ');
 				}
-				struct delayed_event *de = delayed_events;
-				while (de) {
-					if (de->delay < 0) {
-						de->delay = delay + 1;
-						de->event_string = p2 ? my_strdup (p2) : my_strdup(_T(""));
-						de->append = append;
-						break;
-					}
-					de = de->next;
-				}
-				if (!de) {
-					de = xcalloc (delayed_event, 1);
-					de->next = delayed_events;
-					delayed_events = de;
-					de->delay = delay + 1;
-					de->append = append;
-					de->event_string = p2 ? my_strdup (p2) : my_strdup(_T(""));
-				}
+				struct delayed_event *de = get_delayed_event();
+				de->delay = delay + 1;
+				de->append = append;
+				de->at = false;
+				de->event_string = p2 ? my_strdup (p2) : my_strdup(_T(""));
 			}
 			break;
 		}
@@ -3893,9 +3962,14 @@ void inputdevice_hsync (bool forceread)
 	while (de) {
 		if (de->delay < 0)
 			cnt++;
-		if (de->delay > 0)
+		if (de->at) {
+			if (de->delay > 0 && (input_frame > de->frame || (input_frame == de->frame && vpos >= de->line)))
+				de->delay = 0;
+		} else if (de->delay > 0) {
 			de->delay--;
+		}
 		if (de->delay == 0) {
+			de->at = false;
 			de->delay = -1;
 			if (de->event_string) {
 				TCHAR *s = de->event_string;
@@ -4438,6 +4512,9 @@ static bool inputdevice_handle_inputcode2(int monid, int code, int state, const
 	case AKS_WARP:
 		warpmode (newstate);
 		break;
+	case AKS_WARP_RENDER:
+		warp_render_request();
+		break;
 	case AKS_INHIBITSCREEN:
 		toggle_inhibit_frame(monid, IHF_SCROLLLOCK);
 		break;
@@ -7929,6 +8006,7 @@ void inputdevice_init (void)
 
 void inputdevice_close (void)
 {
+	input_poll_stats_log ();
 	idev[IDTYPE_JOYSTICK].close ();
 	idev[IDTYPE_MOUSE].close ();
 	idev[IDTYPE_KEYBOARD].close ();
@@ -9054,7 +9132,7 @@ void warpmode (int mode)
 		currprefs.turbo_emulation = fr;
 	}
 	if (currprefs.turbo_emulation) {
-		if (!currprefs.cpu_memory_cycle_exact && !currprefs.blitter_cycle_exact)
+		if (!currprefs.cpu_memory_cycle_exact && !currprefs.blitter_cycle_exact && !currprefs.turbo_emulation_render)
 			changed_prefs.gfx_framerate = currprefs.gfx_framerate = 10;
 		pause_sound ();
 	} else {
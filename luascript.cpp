@@ -14,11 +14,13 @@
 #include "options.h"
 #include "savestate.h"
 #include "memory.h"
+#include "custom.h"
 #include "debug.h"
 #include "identify.h"
 #include "luascript.h"
 #include "uae.h"
 #include "zfile.h"
+#include "inputdevice.h"
 #include "threaddep/thread.h"
 
 #ifdef WITH_LUA
@@ -102,6 +104,24 @@ static int l_uae_write_config(lua_State *L)
 	return 1;
 }
 
+/* custom event string, "at <frame> [<line>]" entries are scheduled */
+static int l_uae_custom_event(lua_State *L)
+{
+	const char *s = luaL_checkstring(L, 1);
+	TCHAR *ts = au(s);
+	handle_custom_event(ts, 0);
+	xfree(ts);
+	return 0;
+}
+
+/* current input frame and line, for "at" scheduling */
+static int l_uae_get_frame(lua_State *L)
+{
+	lua_pushinteger(L, inputdevice_get_frame());
+	lua_pushinteger(L, vpos);
+	return 2;
+}
+
 static int l_uae_log(lua_State *L)
 {
     const char *s = luaL_checkstring(L, 1);
@@ -198,6 +218,8 @@ void uae_lua_init_state(lua_State *L)
 
 	lua_register(L, "uae_read_config", l_uae_read_config);
 	lua_register(L, "uae_write_config", l_uae_write_config);
+	lua_register(L, "uae_custom_event", l_uae_custom_event);
+	lua_register(L, "uae_get_frame", l_uae_get_frame);
 
 	for (int i = 0; custd[i].name; i++) {
 		char *s = ua(custd[i].name);
@@ -3802,6 +3802,28 @@ int memory_valid_address(uaecptr addr, uae_u32 size)
 	return addr + size <= ab->allocated_size;
 }
 
+// host pointer if whole addr..addr+size-1 range is inside single direct access bank
+static uae_u8 *memory_get_direct(addrbank *ab, uae_u8 *base, uaecptr addr, uae_u32 size)
+{
+	if (!base || &get_mem_bank(addr + size - 1) != ab)
+		return NULL;
+	addr -= ab->startaccessmask;
+	addr &= ab->mask;
+	if (addr + size > ab->allocated_size)
+		return NULL;
+	return base + addr;
+}
+uae_u8 *memory_get_direct_r(uaecptr addr, uae_u32 size)
+{
+	addrbank *ab = &get_mem_bank(addr);
+	return memory_get_direct(ab, ab->baseaddr_direct_r, addr, size);
+}
+uae_u8 *memory_get_direct_w(uaecptr addr, uae_u32 size)
+{
+	addrbank *ab = &get_mem_bank(addr);
+	return memory_get_direct(ab, ab->baseaddr_direct_w, addr, size);
+}
+
 void dma_put_word(uaecptr addr, uae_u16 v)
 {
 	addrbank* ab = &get_mem_bank(addr);
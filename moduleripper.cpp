@@ -20,14 +20,11 @@
 #include "uae.h"
 
 static int got, canceled;
+static uaecptr scan_start;
+static uae_u8 *scan_buf;
 
-static void mc (uae_u8 *d, uaecptr s, int size)
-{
-	int i;
-
-	for (i = 0; i < size; i++)
-		d[i] = get_byte (s++);
-}
+// Pro-Wizard tests can read past the end of the scanned area
+#define SCAN_GUARD 65536
 
 #ifdef _WIN32
 static LONG WINAPI ExceptionFilter (struct _EXCEPTION_POINTERS * pExceptionPointers, DWORD ec)
@@ -36,55 +33,67 @@ static LONG WINAPI ExceptionFilter (struct _EXCEPTION_POINTERS * pExceptionPoint
 }
 #endif
 
+/* Each RAM bank is scanned separately straight from its host memory
+ * instead of byte-copying all banks into one big buffer: no false
+ * matches across bank boundaries, reported addresses are real Amiga
+ * addresses and only the largest bank needs a scratch copy (rippers
+ * are allowed to modify their input). */
+static void scan_bank (addrbank *ab, uae_u32 size)
+{
+	if (!size || !ab->baseaddr || canceled)
+		return;
+	memcpy (scan_buf, ab->baseaddr, size);
+	memset (scan_buf + size, 0, SCAN_GUARD);
+	scan_start = ab->start;
+#ifdef _WIN32
+	__try {
+#endif
+		prowizard_search (scan_buf, size);
+#ifdef _WIN32
+	} __except(ExceptionFilter (GetExceptionInformation (), GetExceptionCode ())) {
+		write_log (_T("prowizard scan crashed at bank %08x\n"), scan_start);
+	}
+#endif
+}
+
 void moduleripper (void)
 {
-	int size;
-	uae_u8 *buf, *p;
+	uae_u32 size;
 
 	size = currprefs.chipmem.size;
 	for (int i = 0; i < MAX_RAM_BOARDS; i++) {
-		size += currprefs.fastmem[i].size;
-		size += currprefs.z3fastmem[i].size;
+		if (currprefs.fastmem[i].size > size)
+			size = currprefs.fastmem[i].size;
+		if (currprefs.z3fastmem[i].size > size)
+			size = currprefs.z3fastmem[i].size;
 	}
-	size += currprefs.bogomem.size;
-	size += currprefs.mbresmem_low.size;
-	size += currprefs.mbresmem_high.size;
-	buf = p = xmalloc (uae_u8, size);
-	if (!buf)
+	if (currprefs.bogomem.size > size)
+		size = currprefs.bogomem.size;
+	if (currprefs.mbresmem_low.size > size)
+		size = currprefs.mbresmem_low.size;
+	if (currprefs.mbresmem_high.size > size)
+		size = currprefs.mbresmem_high.size;
+	scan_buf = xmalloc (uae_u8, size + SCAN_GUARD);
+	if (!scan_buf)
 		return;
-	memcpy (p, chipmem_bank.baseaddr, currprefs.chipmem.size);
-	p += currprefs.chipmem.size;
-	for (int i = 0; i < MAX_RAM_BOARDS; i++) {
-		mc (p, fastmem_bank[i].start, currprefs.fastmem[i].size);
-		p += currprefs.fastmem[i].size;
-	}
-	mc (p, bogomem_bank.start, currprefs.bogomem.size);
-	p += currprefs.bogomem.size;
-	mc (p, a3000lmem_bank.start, currprefs.mbresmem_low.size);
-	p += currprefs.mbresmem_low.size;
-	mc (p, a3000hmem_bank.start, currprefs.mbresmem_high.size);
-	p += currprefs.mbresmem_high.size;
-	for (int i = 0; i < MAX_RAM_BOARDS; i++) {
-		mc (p, z3fastmem_bank[i].start, currprefs.z3fastmem[i].size);
-		p += currprefs.z3fastmem[i].size;
-	}
 
 	got = 0;
 	canceled = 0;
-#ifdef _WIN32
-	__try {
-#endif
-		prowizard_search (buf, size);
-#ifdef _WIN32
-	} __except(ExceptionFilter (GetExceptionInformation (), GetExceptionCode ())) {
-		write_log (_T("prowizard scan crashed\n"));
-	}
-#endif
+	scan_bank (&chipmem_bank, currprefs.chipmem.size);
+	for (int i = 0; i < MAX_RAM_BOARDS; i++)
+		scan_bank (&fastmem_bank[i], currprefs.fastmem[i].size);
+	scan_bank (&bogomem_bank, currprefs.bogomem.size);
+	scan_bank (&a3000lmem_bank, currprefs.mbresmem_low.size);
+	scan_bank (&a3000hmem_bank, currprefs.mbresmem_high.size);
+	for (int i = 0; i < MAX_RAM_BOARDS; i++)
+		scan_bank (&z3fastmem_bank[i], currprefs.z3fastmem[i].size);
+
 	if (!got)
 		notify_user (NUMSG_MODRIP_NOTFOUND);
 	else if (!canceled)
 		notify_user (NUMSG_MODRIP_FINISHED);
-	xfree (buf);
+	xfree (scan_buf);
+	scan_buf = NULL;
 }
 
 static void namesplit(TCHAR *s)
@@ -160,7 +169,7 @@ FILE *moduleripper2_fopen (const char *name, const char *mode, const char *aid,
 	translate_message (NUMSG_MODRIP_SAVE, msg);
 	moduleripper_filename(name, outname, false);
 	id = au (aid);
-	_stprintf (msg2, msg, id, addr, size, outname);
+	_stprintf (msg2, msg, id, scan_start + addr, size, outname);
 	ret = gui_message_multibutton (2, msg2);
 	xfree (id);
 	if (ret < 0)
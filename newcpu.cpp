@@ -113,10 +113,38 @@ const int imm8_table[] = { 8, 1, 2, 3, 4, 5, 6, 7 };
 int movem_index1[256];
 int movem_index2[256];
 int movem_next[256];
+int movem_count[256];
 
 cpuop_func *cpufunctbl[65536];
 cpuop_func *loop_mode_table[65536];
 
+// cycle-exact tables with direct memory access, usable when CPU tracer is inactive
+static const struct cputbl *cpufunctbl_indirect, *cpufunctbl_direct;
+static bool cpufunctbl_isdirect;
+// cpufunctbl_indirect[] entry installed in cpufunctbl[opcode], -1 = other handler
+static uae_s16 cpufunctbl_index[65536];
+
+static void set_cpufunctbl_direct(bool direct)
+{
+	const struct cputbl *from, *to;
+
+	if (!cpufunctbl_direct || cpufunctbl_isdirect == direct)
+		return;
+	from = direct ? cpufunctbl_indirect : cpufunctbl_direct;
+	to = direct ? cpufunctbl_direct : cpufunctbl_indirect;
+	// both tables are generated from the same opcode list, same index = same instruction
+	for (int opcode = 0; opcode < 65536; opcode++) {
+		int idx = cpufunctbl_index[opcode];
+		if (idx < 0)
+			continue;
+		if (cpufunctbl[opcode] == from[idx].handler_ff)
+			cpufunctbl[opcode] = to[idx].handler_ff;
+		if (loop_mode_table[opcode] == from[idx].handler_ff)
+			loop_mode_table[opcode] = to[idx].handler_ff;
+	}
+	cpufunctbl_isdirect = direct;
+}
+
 struct cputbl_data
 {
 	uae_s16 length;
@@ -150,6 +178,16 @@ static struct regstruct fallback_regs;
 static int fallback_new_cpu_model;
 
 int cpu_last_stop_vpos, cpu_stopped_lines;
+int cpu_busywait;
+
+/* Busy-wait loop detection */
+#define BUSYWAIT_MAX_BYTES 32
+#define BUSYWAIT_DETECT 8
+static uaecptr busywait_start, busywait_end;
+static uae_u32 busywait_aregs[8];
+static uae_u16 busywait_opcode;
+static int busywait_cnt;
+static bool busywait_ok;
 
 void (*flush_icache)(int);
 
@@ -421,6 +459,7 @@ static bool check_trace (void)
 	x_do_cycles_pre = x2_do_cycles_pre;
 	x_do_cycles_post = x2_do_cycles_post;
 	set_x_cp_funcs();
+	set_cpufunctbl_direct(true);
 	write_log (_T("CPU tracer playback complete. STARTCYCLES=%08x NOWCYCLES=%08lx\n"), cputrace.startcycles, get_cycles ());
 	cputrace.needendcycles = 1;
 	cpu_tracer = 0;
@@ -1348,6 +1387,7 @@ static void set_x_funcs (void)
 			x_do_cycles_post = cputracefunc2_x_do_cycles_post;
 		}
 	}
+	set_cpufunctbl_direct(cpu_tracer == 0);
 
 	set_x_cp_funcs();
 	mmu_set_funcs();
@@ -1809,6 +1849,11 @@ static const struct cputbl *cputbls[6][8] =
 	// 68060
 	{ op_smalltbl_0, op_smalltbl_40, op_smalltbl_50, op_smalltbl_24, op_smalltbl_24, op_smalltbl_33, op_smalltbl_33, op_smalltbl_33 }
 };
+// cycle-exact without indirect memory access functions
+static const struct cputbl *cputbls_direct[6] =
+{
+	op_smalltbl_16, op_smalltbl_15, op_smalltbl_26, NULL, NULL, NULL
+};
 
 #ifdef JIT
 
@@ -1870,12 +1915,19 @@ static void build_cpufunctbl (void)
 		write_log (_T("no CPU emulation cores available CPU=%d!"), currprefs.cpu_model);
 		abort ();
 	}
+	// set_x_funcs() switches to direct table if CPU tracer is not active
+	cpufunctbl_indirect = tbl;
+	cpufunctbl_direct = mode == 4 ? cputbls_direct[lvl] : NULL;
+	cpufunctbl_isdirect = false;
 
-	for (opcode = 0; opcode < 65536; opcode++)
+	for (opcode = 0; opcode < 65536; opcode++) {
 		cpufunctbl[opcode] = op_illg_1;
+		cpufunctbl_index[opcode] = -1;
+	}
 	for (i = 0; tbl[i].handler_ff != NULL; i++) {
 		opcode = tbl[i].opcode;
 		cpufunctbl[opcode] = tbl[i].handler_ff;
+		cpufunctbl_index[opcode] = i;
 		cpudatatbl[opcode].length = tbl[i].length;
 		cpudatatbl[opcode].disp020[0] = tbl[i].disp020[0];
 		cpudatatbl[opcode].disp020[1] = tbl[i].disp020[1];
@@ -1888,6 +1940,7 @@ static void build_cpufunctbl (void)
 		for (i = 0; tbl[i].handler_ff != NULL; i++) {
 			if ((tbl[i].opcode & 0xfe00) == 0xf200) {
 				cpufunctbl[tbl[i].opcode] = tbl[i].handler_ff;
+				cpufunctbl_index[tbl[i].opcode] = -1;
 				cpudatatbl[tbl[i].opcode].length = tbl[i].length;
 				cpudatatbl[tbl[i].opcode].disp020[0] = tbl[i].disp020[0];
 				cpudatatbl[tbl[i].opcode].disp020[1] = tbl[i].disp020[1];
@@ -1912,6 +1965,7 @@ static void build_cpufunctbl (void)
 				// generates unimplemented instruction exception.
 				if (currprefs.int_no_unimplemented && table->unimpclev == 5) {
 					cpufunctbl[opcode] = op_unimpl_1;
+					cpufunctbl_index[opcode] = -1;
 					continue;
 				}
 				// remove unimplemented instruction that were removed in previous models,
@@ -1920,10 +1974,12 @@ static void build_cpufunctbl (void)
 				// clev=4: implemented in 68040 or later. unimpclev=5: not in 68060
 				if (table->unimpclev < 5 || (table->clev == 4 && table->unimpclev == 5)) {
 					cpufunctbl[opcode] = op_illg_1;
+					cpufunctbl_index[opcode] = -1;
 					continue;
 				}
 			} else {
 				cpufunctbl[opcode] = op_illg_1;
+				cpufunctbl_index[opcode] = -1;
 				continue;
 			}
 		}
@@ -1942,6 +1998,7 @@ static void build_cpufunctbl (void)
 			if (f == op_illg_1)
 				abort ();
 			cpufunctbl[opcode] = f;
+			cpufunctbl_index[opcode] = cpufunctbl_index[idx];
 			memcpy(&cpudatatbl[opcode], &cpudatatbl[idx], sizeof(struct cputbl_data));
 			opcnt++;
 		}
@@ -2182,6 +2239,7 @@ void check_prefs_changed_cpu(void)
 		return;
 
 	currprefs.cpu_idle = changed_prefs.cpu_idle;
+	currprefs.cpu_idle_busywait = changed_prefs.cpu_idle_busywait;
 	currprefs.ppc_cpu_idle = changed_prefs.ppc_cpu_idle;
 	currprefs.reset_delay = changed_prefs.reset_delay;
 	currprefs.cpuboard_settings = changed_prefs.cpuboard_settings;
@@ -2205,6 +2263,11 @@ void init_m68k (void)
 		movem_index1[i] = j;
 		movem_index2[i] = 7 - j;
 		movem_next[i] = i & (~(1 << j));
+		movem_count[i] = 0;
+		for (j = 0 ; j < 8 ; j++) {
+			if (i & (1 << j))
+				movem_count[i]++;
+		}
 	}
 
 #if COUNT_INSTRS
@@ -3458,6 +3521,8 @@ static void m68k_reset2(bool hardreset)
 	regs.spcflags = 0;
 	m68k_reset_delay = 0;
 	regs.ipl = regs.ipl_pin = 0;
+	busywait_start = busywait_end = 0;
+	cpu_busywait = 0;
 	for (int i = 0; i < IRQ_SOURCE_MAX; i++) {
 		uae_interrupts2[i] = 0;
 		uae_interrupts6[i] = 0;
@@ -3614,6 +3679,7 @@ static void cpu_do_fallback(void)
 		fallback_cpu_model = 0;
 	}
 	init_m68k();
+	// indirect table until m68k_go() calls set_x_funcs()
 	build_cpufunctbl();
 	m68k_reset2(false);
 	if (!fallbackmode) {
@@ -6117,6 +6183,189 @@ static void cpu_thread_run_2(void *v)
 }
 #endif
 
+/* Busy-wait loop detection.
+ *
+ * Short backward branch loops that only test memory or load it into
+ * data registers can't exit until something else (DMA, interrupt,
+ * chipset or CIA state, other CPU) changes the memory they poll. All
+ * of those happen in events, so instead of executing the same loop
+ * thousands of times, skip to the next event and mark the CPU idle
+ * for the hsync sleep logic, like STOP does.
+ */
+
+// registers that only change in events, not with horizontal position
+static bool busywait_address(uaecptr addr, wordsizes size)
+{
+	addrbank *ab = &get_mem_bank(addr);
+
+	if (size == sz_long)
+		return busywait_address(addr, sz_word) && busywait_address(addr + 2, sz_word);
+	if (ab->flags & (ABFLAG_RAM | ABFLAG_ROM))
+		return true;
+	if (ab == &custom_bank) {
+		switch (addr & 0x1fe)
+		{
+		case 0x002: // DMACONR
+		case 0x004: // VPOSR
+		case 0x00a: // JOY0DAT
+		case 0x00c: // JOY1DAT
+		case 0x010: // ADKCONR
+		case 0x016: // POTGOR
+		case 0x01c: // INTENAR
+		case 0x01e: // INTREQR
+			return true;
+		case 0x006: // VHPOSR, vertical position only
+			return size == sz_byte && !(addr & 1);
+		}
+		return false;
+	}
+	if (ab->flags & ABFLAG_CIA) {
+		// not timer counters
+		int reg = (addr >> 8) & 15;
+		return reg < 4 || reg > 7;
+	}
+	return false;
+}
+
+static bool busywait_operand(amodes mode, int reg, wordsizes size, uaecptr *pcp)
+{
+	uaecptr pc = *pcp;
+	uaecptr addr;
+
+	switch (mode)
+	{
+	case Dreg:
+	case Areg:
+	case immi:
+	case am_unknown:
+		return true;
+	case imm0:
+	case imm1:
+		*pcp += 2;
+		return true;
+	case imm2:
+		*pcp += 4;
+		return true;
+	case imm:
+		*pcp += size == sz_long ? 4 : 2;
+		return true;
+	case Aind:
+		addr = m68k_areg(regs, reg);
+		break;
+	case Ad16:
+		addr = m68k_areg(regs, reg) + (uae_s32)(uae_s16)get_word(pc);
+		*pcp += 2;
+		break;
+	case PC16:
+		addr = pc + (uae_s32)(uae_s16)get_word(pc);
+		*pcp += 2;
+		break;
+	case absw:
+		addr = (uae_s32)(uae_s16)get_word(pc);
+		*pcp += 2;
+		break;
+	case absl:
+		addr = get_long(pc);
+		*pcp += 4;
+		break;
+	default:
+		// (An)+, -(An) and indexed modes change or depend on registers
+		return false;
+	}
+	return busywait_address(addr, size);
+}
+
+static bool busywait_analyze(uaecptr start, uaecptr end)
+{
+	uaecptr pc = start;
+
+	if (end - start > BUSYWAIT_MAX_BYTES)
+		return false;
+	if (!(get_mem_bank(start).flags & (ABFLAG_RAM | ABFLAG_ROM)))
+		return false;
+	while (pc < end) {
+		uae_u16 opcode = get_word(pc);
+		struct instr *dp = table68k + opcode;
+		if (cpufunctbl[opcode] == op_illg_1)
+			return false;
+		pc += 2;
+		switch (dp->mnemo)
+		{
+		case i_TST:
+		case i_CMP:
+		case i_CMPA:
+		case i_BTST:
+		case i_Bcc:
+		case i_NOP:
+			break;
+		case i_MOVE:
+		case i_AND:
+		case i_OR:
+			// repeating these gives the same result if memory didn't change
+			if (dp->dmode != Dreg)
+				return false;
+			break;
+		default:
+			return false;
+		}
+		if (!busywait_operand(dp->smode, dp->sreg, dp->size, &pc))
+			return false;
+		if (!busywait_operand(dp->dmode, dp->dreg, dp->size, &pc))
+			return false;
+	}
+	return pc == end;
+}
+
+static void busywait_skip(void)
+{
+	long c = nextevent - currcycle;
+
+	cpu_busywait = 1;
+	// give up extra CPU time slice, nothing can change until next event
+	if (is_syncline <= -10 && is_syncline > -100)
+		events_reset_syncline();
+	if (c > 0)
+		do_cycles(c);
+}
+
+// called after taken backward Bcc/BRA
+static void m68k_busywait(void)
+{
+	uaecptr start = m68k_getpc();
+	uaecptr end = regs.instruction_pc;
+
+	if (start != busywait_start || end != busywait_end || regs.opcode != busywait_opcode) {
+		busywait_start = start;
+		busywait_end = end;
+		busywait_opcode = regs.opcode;
+		memcpy(busywait_aregs, &regs.regs[8], sizeof busywait_aregs);
+		busywait_cnt = 0;
+		busywait_ok = busywait_analyze(start, end);
+		return;
+	}
+	// rejected loops (copy/clear loops using (An)+ etc) stay rejected,
+	// missing an idle loop is harmless.
+	if (!busywait_ok)
+		return;
+	// accepted loop can't change An, different An = entered again with new addresses
+	if (memcmp(busywait_aregs, &regs.regs[8], sizeof busywait_aregs)) {
+		memcpy(busywait_aregs, &regs.regs[8], sizeof busywait_aregs);
+		busywait_cnt = 0;
+		busywait_ok = busywait_analyze(start, end);
+		return;
+	}
+	if (busywait_cnt < BUSYWAIT_DETECT) {
+		busywait_cnt++;
+		return;
+	}
+	busywait_skip();
+}
+
+STATIC_INLINE bool is_busywait_branch(struct regstruct *r)
+{
+	return (r->opcode & 0xf000) == 0x6000 && (r->opcode & 0x0f00) != 0x0100 && m68k_getpc() < r->instruction_pc;
+}
+
 /* Same thing, but don't use prefetch to get opcode.  */
 static void m68k_run_2_000(void)
 {
@@ -6140,6 +6389,9 @@ static void m68k_run_2_000(void)
 				cpu_cycles = adjust_cycles (cpu_cycles);
 				do_cycles(cpu_cycles);
 
+				if (currprefs.cpu_idle_busywait && is_busywait_branch(r))
+					m68k_busywait();
+
 				if (r->spcflags) {
 					if (do_specialties (cpu_cycles))
 						exit = true;
@@ -6184,6 +6436,9 @@ static void m68k_run_2_020(void)
 				cpu_cycles = adjust_cycles(cpu_cycles);
 				do_cycles(cpu_cycles);
 
+				if (currprefs.cpu_idle_busywait && is_busywait_branch(r))
+					m68k_busywait();
+
 				if (r->spcflags) {
 					if (do_specialties(cpu_cycles))
 						exit = true;
@@ -8234,19 +8489,18 @@ STATIC_INLINE void update_dcache030 (struct cache030 *c, uae_u32 val, uae_u32 ta
 	c->data[lws] = val;
 }
 
-static bool maybe_icache030(uae_u32 addr)
+// holding register or cache hit: no bus cycles, no cycle accounting.
+STATIC_INLINE bool icache030_hit(uae_u32 addr)
 {
 	int lws;
 	uae_u32 tag;
 	struct cache030 *c;
 
 	regs.fc030 = (regs.s ? 4 : 0) | 2;
-	addr &= ~3;
 	if (regs.cacheholdingaddr020 == addr || regs.cacheholdingdata_valid == 0)
 		return true;
 	c = geticache030(icaches030, addr, &tag, &lws);
 	if ((regs.cacr & 1) && c->valid[lws] && c->tag == tag) {
-		// cache hit
 		regs.cacheholdingaddr020 = addr;
 		regs.cacheholdingdata020 = c->data[lws];
 		return true;
@@ -8254,24 +8508,21 @@ static bool maybe_icache030(uae_u32 addr)
 	return false;
 }
 
-static void fill_icache030(uae_u32 addr)
+static bool maybe_icache030(uae_u32 addr)
+{
+	return icache030_hit(addr & ~3);
+}
+
+// cache miss: bus fetch, optional burst fill. Kept out of line so that
+// the hit path stays small enough to inline into the prefetch functions.
+static void NOINLINE fill_icache030_miss(uae_u32 addr)
 {
 	int lws;
 	uae_u32 tag;
 	uae_u32 data;
 	struct cache030 *c;
 
-	regs.fc030 = (regs.s ? 4 : 0) | 2;
-	addr &= ~3;
-	if (regs.cacheholdingaddr020 == addr || regs.cacheholdingdata_valid == 0)
-		return;
 	c = geticache030 (icaches030, addr, &tag, &lws);
-	if ((regs.cacr & 1) && c->valid[lws] && c->tag == tag) {
-		// cache hit
-		regs.cacheholdingaddr020 = addr;
-		regs.cacheholdingdata020 = c->data[lws];
-		return;
-	}
 
 	TRY (prb2) {
 		// cache miss
@@ -8335,6 +8586,13 @@ static void fill_icache030(uae_u32 addr)
 	regs.cacheholdingdata020 = data;
 }
 
+STATIC_INLINE void fill_icache030(uae_u32 addr)
+{
+	addr &= ~3;
+	if (!icache030_hit(addr))
+		fill_icache030_miss(addr);
+}
+
 #if VALIDATE_68030_DATACACHE
 static void validate_dcache030(void)
 {
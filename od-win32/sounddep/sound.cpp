@@ -111,6 +111,7 @@ struct sound_dp
 	int wasapiexclusive;
 	int sndbuf;
 	int wasapigoodsize;
+	int wasapistatskip;
 	int pullmode;
 	HANDLE pullevent, pullevent2;
 	uae_u8 *pullbuffer;
@@ -167,6 +168,27 @@ static int num_sound_devices, num_record_devices;
 static struct sound_data sdpaula;
 static struct sound_data *sdp = &sdpaula;
 
+// underrun count and average queued output latency of paula output, logged when sound is closed
+static volatile LONG snd_underruns;
+static double snd_latency_sum;
+static int snd_latency_cnt;
+
+// also called from PortAudio callback thread
+static void sound_stats_underrun (struct sound_data *sd)
+{
+	if (sd != sdp)
+		return;
+	InterlockedIncrement (&snd_underruns);
+}
+
+static void sound_stats_latency (struct sound_data *sd, int frames)
+{
+	if (sd != sdp || !sd->freq)
+		return;
+	snd_latency_sum += frames * 1000.0 / sd->freq;
+	snd_latency_cnt++;
+}
+
 static uae_u8 *extrasndbuf;
 static int extrasndbufsize;
 static int extrasndbuffered;
@@ -410,6 +432,7 @@ static void resume_audio_wasapi (struct sound_data *sd)
 	if (FAILED(hr)) {
 		write_log(_T("WASAPI: Resume ReleaseBuffer() %08X\n"), hr);
 	}
+	s->wasapistatskip = 1;
 	hr = s->pAudioClient->Start ();
 	wasapi_check_state(sd, hr);
 	if (FAILED (hr)) {
@@ -726,6 +749,7 @@ static int _cdecl portAudioCallback (const void *inputBuffer, void *outputBuffer
 		SetEvent(s->pullevent);
 		WaitForSingleObject(s->pullevent2, 1);
 		if (s->pullbufferlen <= 0) {
+			sound_stats_underrun (sd);
 			return paContinue;
 		}
 	}
@@ -1999,6 +2023,15 @@ void close_sound (void)
 	if (! have_sound)
 		return;
 	close_sound_device (sdp);
+	LONG underruns = InterlockedExchange (&snd_underruns, 0);
+	if (underruns || snd_latency_cnt) {
+		if (snd_latency_cnt)
+			write_log (_T("SOUND: %d underruns, average latency %.1fms\n"), underruns, snd_latency_sum / snd_latency_cnt);
+		else
+			write_log (_T("SOUND: %d underruns\n"), underruns);
+	}
+	snd_latency_sum = 0;
+	snd_latency_cnt = 0;
 	have_sound = 0;
 	extrasndbufsize = 0;
 	extrasndbuffered = 0;
@@ -2184,6 +2217,7 @@ static void finish_sound_buffer_al (struct sound_data *sd, uae_u16 *sndbuffer)
 			} else {
 				gui_data.sndbuf_status = 2;
 				statuscnt = SND_STATUSCNT;
+				sound_stats_underrun (sd);
 				write_log (_T("AL underflow\n"));
 				clearbuffer (sd);
 				sd->waiting_for_buffer = 1;
@@ -2201,6 +2235,7 @@ static void finish_sound_buffer_al (struct sound_data *sd, uae_u16 *sndbuffer)
 		alcheck (sd, 7);
 		v -= s->al_offset;
 
+		sound_stats_latency (sd, v / sd->samplesize);
 		docorrection (s, 100 * v / sd->sndbufsize, v / sd->samplesize, 100);
 
 #if 0
@@ -2261,6 +2296,9 @@ static void finish_sound_buffer_xaudio2 (struct sound_data *sd, uae_u16 *sndbuff
 				statuscnt = SND_STATUSCNT;
 				gui_data.sndbuf_status = 2;
 			}
+			// resume queues silence, empty queue means voice has starved
+			if (state.BuffersQueued == 0)
+				sound_stats_underrun (sd);
 			break;
 		}
 		gui_data.sndbuf_status = 1;
@@ -2276,6 +2314,7 @@ static void finish_sound_buffer_xaudio2 (struct sound_data *sd, uae_u16 *sndbuff
 		oldpadding = avail;
 	}
 
+	sound_stats_latency (sd, avail);
 	docorrection (s, (goodsize - avail) * 1000 / goodsize, goodsize - avail, 100);
 
 	memcpy (s->xdata[s->xabufcnt], sndbuffer, sd->sndbufsize);
@@ -2316,6 +2355,10 @@ static void finish_sound_buffer_wasapi_push(struct sound_data *sd, uae_u16 *sndb
 				statuscnt = SND_STATUSCNT;
 				gui_data.sndbuf_status = 2;
 			}
+			// padding is zero on first buffer after start, not an underrun
+			if (numFramesPadding == 0 && !s->wasapistatskip)
+				sound_stats_underrun (sd);
+			s->wasapistatskip = 0;
 			break;
 		}
 		gui_data.sndbuf_status = 1;
@@ -2331,6 +2374,7 @@ static void finish_sound_buffer_wasapi_push(struct sound_data *sd, uae_u16 *sndb
 		oldpadding = numFramesPadding;
 	}
 
+	sound_stats_latency (sd, numFramesPadding);
 	docorrection (s, (s->wasapigoodsize - avail) * 1000 / s->wasapigoodsize, s->wasapigoodsize - avail, 100);
 
 	hr = s->pRenderClient->GetBuffer (sd->sndbufframes, &pData);
@@ -2371,6 +2415,10 @@ static bool finish_sound_buffer_wasapi_pull_do(struct sound_data *sd)
 			return false;
 		if (avail > frames)
 			avail = frames;
+		if (numFramesPadding == 0 && !s->wasapistatskip)
+			sound_stats_underrun (sd);
+		s->wasapistatskip = 0;
+		sound_stats_latency (sd, numFramesPadding);
 	}
 
 	ResetEvent(s->pullevent);
@@ -2514,6 +2562,7 @@ static void finish_sound_buffer_ds (struct sound_data *sd, uae_u16 *sndbuffer)
 #endif
 			gui_data.sndbuf_status = -1;
 			statuscnt = SND_STATUSCNT;
+			sound_stats_underrun (sd);
 			if (diff > s->snd_totalmaxoffset_uf)
 				s->writepos += s->dsoundbuf - diff;
 			s->writepos += sd->sndbufsize;
@@ -2562,6 +2611,7 @@ static void finish_sound_buffer_ds (struct sound_data *sd, uae_u16 *sndbuffer)
 	if (sd == sdp) {
 		double vdiff, m, skipmode;
 
+		sound_stats_latency (sd, diff / sd->samplesize);
 		vdiff = (diff - s->snd_writeoffset) / sd->samplesize;
 		m = 100.0 * vdiff / (s->max_sndbufsize / sd->samplesize);
 		skipmode = sync_sound (m);
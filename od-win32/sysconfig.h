@@ -59,8 +59,10 @@
 #define CPUEMU_0 /* generic 680x0 emulation */
 #define CPUEMU_11 /* 68000/68010 prefetch emulation */
 #define CPUEMU_13 /* 68000/68010 cycle-exact cpu&blitter */
+#define CPUEMU_15 /* 68000/68010 cycle-exact, direct memory access */
 #define CPUEMU_20 /* 68020 prefetch */
 #define CPUEMU_21 /* 68020 "cycle-exact" + blitter */
+#define CPUEMU_26 /* 68020 "cycle-exact", direct memory access */
 #define CPUEMU_22 /* 68030 prefetch */
 #define CPUEMU_23 /* 68030 "cycle-exact" + blitter */
 #define CPUEMU_24 /* 68060 "cycle-exact" + blitter */
@@ -122,6 +124,7 @@
 #endif
 #define CAPS
 #define CPUEMU_13
+#define CPUEMU_15
 #define CPUEMU_11
 
 
@@ -1335,20 +1335,55 @@ STATIC_INLINE int notcrc32 (uae_u32 crc32)
 	return 0;
 }
 
+/* CRC32 and SHA1 lookup hash chains, built on first use. Chains keep
+ * table order so lookups return the same entry as a linear scan. */
+#define ROM_HASH_SIZE 1024
+#define ROM_COUNT (sizeof roms / sizeof (struct romdata))
+static int rom_crc_hash[ROM_HASH_SIZE], rom_sha1_hash[ROM_HASH_SIZE];
+static int rom_crc_next[ROM_COUNT], rom_sha1_next[ROM_COUNT];
+static bool rom_hash_done;
+
+static void rom_hash_init (void)
+{
+	int i, cnt;
+
+	if (rom_hash_done)
+		return;
+	for (i = 0; i < ROM_HASH_SIZE; i++)
+		rom_crc_hash[i] = rom_sha1_hash[i] = -1;
+	cnt = 0;
+	while (roms[cnt].name)
+		cnt++;
+	for (i = cnt - 1; i >= 0; i--) {
+		struct romdata *rd = &roms[i];
+		int h;
+		if (notcrc32 (rd->crc32))
+			continue;
+		h = rd->crc32 & (ROM_HASH_SIZE - 1);
+		rom_crc_next[i] = rom_crc_hash[h];
+		rom_crc_hash[h] = i;
+		h = rd->sha1[0] & (ROM_HASH_SIZE - 1);
+		rom_sha1_next[i] = rom_sha1_hash[h];
+		rom_sha1_hash[h] = i;
+	}
+	rom_hash_done = true;
+}
+
 struct romdata *getromdatabycrc (uae_u32 crc32, bool allowgroup)
 {
-	int i = 0;
-	while (roms[i].name) {
-		if (roms[i].group == 0 && crc32 == roms[i].crc32 && !notcrc32(crc32))
+	int i;
+
+	if (notcrc32 (crc32))
+		return 0;
+	rom_hash_init ();
+	for (i = rom_crc_hash[crc32 & (ROM_HASH_SIZE - 1)]; i >= 0; i = rom_crc_next[i]) {
+		if (roms[i].group == 0 && crc32 == roms[i].crc32)
 			return &roms[i];
-		i++;
 	}
 	if (allowgroup) {
-		i = 0;
-		while (roms[i].name) {
-			if (roms[i].group && crc32 == roms[i].crc32 && !notcrc32(crc32))
+		for (i = rom_crc_hash[crc32 & (ROM_HASH_SIZE - 1)]; i >= 0; i = rom_crc_next[i]) {
+			if (roms[i].group && crc32 == roms[i].crc32)
 				return &roms[i];
-			i++;
 		}
 	}
 	return 0;
@@ -1386,15 +1421,17 @@ struct romdata *getfrombydefaultname(const TCHAR *name, int size)
 
 static struct romdata *checkromdata (const uae_u8 *sha1, int size, uae_u32 mask)
 {
-	int i = 0;
-	while (roms[i].name) {
-		if (!notcrc32(roms[i].crc32) && roms[i].size >= size) {
+	uae_u32 v = (sha1[0] << 24) | (sha1[1] << 16) | (sha1[2] << 8) | (sha1[3] << 0);
+	int i;
+
+	rom_hash_init ();
+	for (i = rom_sha1_hash[v & (ROM_HASH_SIZE - 1)]; i >= 0; i = rom_sha1_next[i]) {
+		if (roms[i].size >= size) {
 			if (roms[i].type & mask) {
 				if (!cmpsha1 (sha1, &roms[i]))
 					return &roms[i];
 			}
 		}
-		i++;
 	}
 	return NULL;
 }
@@ -266,6 +266,17 @@ static uae_sem_t trap_mutex;
 static TrapContext *current_context;
 
 
+/* Idle trap contexts whose threads are waiting for the next extended trap.
+* Only touched from the emulator thread. */
+#define TRAP_CONTEXT_POOL 8
+static TrapContext *trap_context_pool[TRAP_CONTEXT_POOL];
+static int trap_context_pool_cnt;
+static int trap_context_threads;
+static unsigned int extended_trap_cnt;
+static unsigned int trap_switch_cnt;
+/* host time from switch to trap context until it switches back */
+static uae_s64 trap_switch_time;
+
 /*
 * Thread body for trap context
 */
@@ -273,39 +284,105 @@ static void trap_thread (void *arg)
 {
 	TrapContext *context = (TrapContext *) arg;
 
-	/* Wait until main thread is ready to switch to the
-	* this trap context. */
-	uae_sem_wait (&context->switch_to_trap_sem);
+	for (;;) {
+		/* Wait until main thread is ready to switch to the
+		* this trap context. */
+		uae_sem_wait (&context->switch_to_trap_sem);
 
-	/* Execute trap handler function. */
-	context->trap_retval = context->trap_handler (context);
+		/* NULL handler: context is being released. */
+		if (!context->trap_handler)
+			break;
 
-	/* Trap handler is done - we still need to tidy up
-	* and make sure the handler's return value is propagated
-	* to the calling 68k thread.
-	*
-	* We do this by causing our exit handler to be executed on the 68k context.
-	*/
+		/* Execute trap handler function. */
+		context->trap_retval = context->trap_handler (context);
 
-	/* Enter critical section - only one trap at a time, please! */
-	uae_sem_wait (&trap_mutex);
+		/* Trap handler is done - we still need to tidy up
+		* and make sure the handler's return value is propagated
+		* to the calling 68k thread.
+		*
+		* We do this by causing our exit handler to be executed on the 68k context.
+		*/
 
-	//regs = context->saved_regs;
-	/* Set PC to address of the exit handler, so that it will be called
-	* when the 68k context resumes. */
-	copyfromcpucontext (&context->saved_regs, exit_trap_trapaddr);
-	/* Don't allow an interrupt and thus potentially another
-	* trap to be invoked while we hold the above mutex.
-	* This is probably just being paranoid. */
-	regs.intmask = 7;
+		/* Enter critical section - only one trap at a time, please! */
+		uae_sem_wait (&trap_mutex);
+
+		//regs = context->saved_regs;
+		/* Set PC to address of the exit handler, so that it will be called
+		* when the 68k context resumes. */
+		copyfromcpucontext (&context->saved_regs, exit_trap_trapaddr);
+		/* Don't allow an interrupt and thus potentially another
+		* trap to be invoked while we hold the above mutex.
+		* This is probably just being paranoid. */
+		regs.intmask = 7;
+
+		//m68k_setpc (exit_trap_trapaddr);
+		current_context = context;
+
+		/* Switch back to 68k context */
+		uae_sem_post (&context->switch_to_emu_sem);
+
+		/* Back to the pool, wait for the next trap. */
+	}
+}
 
-	//m68k_setpc (exit_trap_trapaddr);
-	current_context = context;
+static TrapContext *alloc_trap_context(void)
+{
+	TrapContext *context;
 
-	/* Switch back to 68k context */
-	uae_sem_post (&context->switch_to_emu_sem);
+	if (trap_context_pool_cnt > 0) {
+		context = trap_context_pool[--trap_context_pool_cnt];
+		/* Pooled thread may still be on its way back to switch_to_trap_sem:
+		* reset only per-call state, never thread or semaphores. */
+		context->trap_handler = NULL;
+		context->trap_has_retval = 0;
+		context->trap_retval = 0;
+		memset(&context->saved_regs, 0, sizeof(context->saved_regs));
+		context->call68k_func_addr = 0;
+		context->call68k_retval = 0;
+		context->host_trap_data = NULL;
+		context->host_trap_status = NULL;
+		context->amiga_trap_data = 0;
+		context->amiga_trap_status = 0;
+		context->trap_background = 0;
+		context->trap_done = false;
+		memset(context->calllib_regs, 0, sizeof(context->calllib_regs));
+		memset(context->calllib_reg_inuse, 0, sizeof(context->calllib_reg_inuse));
+		context->tindex = 0;
+		context->tcnt = 0;
+		context->callback = NULL;
+		context->callback_ud = NULL;
+		context->trap_mode = 0;
+		context->trap_slot = 0;
+		return context;
+	}
+	context = xcalloc(TrapContext, 1);
+	if (!context)
+		return NULL;
+	uae_sem_init(&context->switch_to_trap_sem, 0, 0);
+	uae_sem_init(&context->switch_to_emu_sem, 0, 0);
+	/* Start thread to handle new trap context. */
+	uae_start_thread_fast(trap_thread, (void *)context, &context->thread);
+	trap_context_threads++;
+	return context;
+}
 
-	/* Good bye, cruel world... */
+static void destroy_trap_context(TrapContext *context)
+{
+	context->trap_handler = NULL;
+	uae_sem_post(&context->switch_to_trap_sem);
+	uae_wait_thread(context->thread);
+	uae_sem_destroy(&context->switch_to_trap_sem);
+	uae_sem_destroy(&context->switch_to_emu_sem);
+	xfree(context);
+}
+
+static void free_trap_context(TrapContext *context)
+{
+	if (trap_context_pool_cnt < TRAP_CONTEXT_POOL) {
+		trap_context_pool[trap_context_pool_cnt++] = context;
+		return;
+	}
+	destroy_trap_context(context);
 }
 
 
@@ -314,11 +391,10 @@ static void trap_thread (void *arg)
 */
 static void trap_HandleExtendedTrap(TrapHandler handler_func, int has_retval)
 {
-	struct TrapContext *context = xcalloc(TrapContext, 1);
+	struct TrapContext *context = alloc_trap_context();
 
 	if (context) {
-		uae_sem_init(&context->switch_to_trap_sem, 0, 0);
-		uae_sem_init(&context->switch_to_emu_sem, 0, 0);
+		extended_trap_cnt++;
 
 		context->trap_handler = handler_func;
 		context->trap_has_retval = has_retval;
@@ -326,12 +402,11 @@ static void trap_HandleExtendedTrap(TrapHandler handler_func, int has_retval)
 		//context->saved_regs = regs;
 		copytocpucontext(&context->saved_regs);
 
-		/* Start thread to handle new trap context. */
-		uae_start_thread_fast(trap_thread, (void *)context, &context->thread);
-
 		/* Switch to trap context to begin execution of
 		* trap handler function.
 		*/
+		frame_time_t t = read_processor_time();
+		trap_switch_cnt++;
 		uae_sem_post(&context->switch_to_trap_sem);
 
 		/* Wait for trap context to switch back to us.
@@ -339,6 +414,7 @@ static void trap_HandleExtendedTrap(TrapHandler handler_func, int has_retval)
 		* It'll do this when the trap handler is done - or when
 		* the handler wants to call 68k code. */
 		uae_sem_wait(&context->switch_to_emu_sem);
+		trap_switch_time += (int)(read_processor_time() - t);
 
 		if (trace_traps) {
 			write_log(_T("Exit extended trap PC=%08x\n"), m68k_getpc());
@@ -461,6 +537,8 @@ static uae_u32 REGPARAM2 m68k_return_handler(TrapContext *dummy_ctx)
 	context->call68k_retval = m68k_dreg(regs, 0);
 
 	/* Switch back to trap context. */
+	frame_time_t t = read_processor_time();
+	trap_switch_cnt++;
 	uae_sem_post(&context->switch_to_trap_sem);
 
 	/* Wait for trap context to switch back to us.
@@ -468,6 +546,7 @@ static uae_u32 REGPARAM2 m68k_return_handler(TrapContext *dummy_ctx)
 	* It'll do this when the trap handler is done - or when
 	* the handler wants to call another 68k function. */
 	uae_sem_wait(&context->switch_to_emu_sem);
+	trap_switch_time += (int)(read_processor_time() - t);
 
 	/* Dummy return value. */
 	return 0;
@@ -485,9 +564,6 @@ static uae_u32 REGPARAM2 exit_trap_handler(TrapContext *dummy_ctx)
 		write_log(_T("exit_trap_handler waiting PC=%08x\n"), context->saved_regs.pc);
 	}
 
-	/* Wait for trap context thread to exit. */
-	uae_wait_thread(context->thread);
-
 	/* Restore 68k state saved at trap entry. */
 	//regs = context->saved_regs;
 	copyfromcpucontext(&context->saved_regs, context->saved_regs.pc);
@@ -497,10 +573,7 @@ static uae_u32 REGPARAM2 exit_trap_handler(TrapContext *dummy_ctx)
 	if (context->trap_has_retval)
 		m68k_dreg(regs, 0) = context->trap_retval;
 
-	uae_sem_destroy(&context->switch_to_trap_sem);
-	uae_sem_destroy(&context->switch_to_emu_sem);
-
-	xfree(context);
+	free_trap_context(context);
 
 	/* End critical section */
 	uae_sem_post(&trap_mutex);
@@ -844,6 +917,18 @@ void free_traps(void)
 			trap_thread_id[i] = NULL;
 		}
 	}
+	if (extended_trap_cnt) {
+		write_log(_T("Extended traps: %u calls, %u switches to trap context, %d trap threads created\n"), extended_trap_cnt, trap_switch_cnt, trap_context_threads);
+		if (trap_switch_cnt && syncbase > 0)
+			write_log(_T("Extended traps: average %d us in trap context per switch\n"),
+				(int)(trap_switch_time * 1000000 / trap_switch_cnt / syncbase));
+	}
+	while (trap_context_pool_cnt > 0)
+		destroy_trap_context(trap_context_pool[--trap_context_pool_cnt]);
+	extended_trap_cnt = 0;
+	trap_switch_cnt = 0;
+	trap_switch_time = 0;
+	trap_context_threads = 0;
 }
 
 /*
@@ -1111,6 +1196,20 @@ uae_u8 trap_get_byte(TrapContext *ctx, uaecptr addr)
 	}
 }
 
+/* Length of the run from addr (at most cnt bytes) that stays inside one
+* 64k memory bank, and its host pointer if the bank is directly accessible. */
+static int trap_bank_run(uaecptr addr, int cnt, uae_u8 **realp)
+{
+	int len = 65536 - (addr & 65535);
+	if (len > cnt)
+		len = cnt;
+	if (real_address_allowed() && valid_address(addr, len))
+		*realp = get_real_address(addr);
+	else
+		*realp = NULL;
+	return len;
+}
+
 void trap_put_bytes(TrapContext *ctx, const void *haddrp, uaecptr addr, int cnt)
 {
 	if (cnt <= 0)
@@ -1126,13 +1225,18 @@ void trap_put_bytes(TrapContext *ctx, const void *haddrp, uaecptr addr, int cnt)
 			cnt -= max;
 		}
 	} else {
-		if (real_address_allowed() && valid_address(addr, cnt)) {
-			memcpy(get_real_address(addr), haddr, cnt);
-		} else {
-			for (int i = 0; i < cnt; i++) {
-				put_byte(addr, *haddr++);
-				addr++;
+		while (cnt > 0) {
+			uae_u8 *p;
+			int len = trap_bank_run(addr, cnt, &p);
+			if (p) {
+				memcpy(p, haddr, len);
+			} else {
+				for (int i = 0; i < len; i++)
+					put_byte(addr + i, haddr[i]);
 			}
+			haddr += len;
+			addr += len;
+			cnt -= len;
 		}
 	}
 }
@@ -1151,13 +1255,18 @@ void trap_get_bytes(TrapContext *ctx, void *haddrp, uaecptr addr, int cnt)
 			cnt -= max;
 		}
 	} else {
-		if (real_address_allowed() && valid_address(addr, cnt)) {
-			memcpy(haddr, get_real_address(addr), cnt);
-		} else {
-			for (int i = 0; i < cnt; i++) {
-				*haddr++ = get_byte(addr);
-				addr++;
+		while (cnt > 0) {
+			uae_u8 *p;
+			int len = trap_bank_run(addr, cnt, &p);
+			if (p) {
+				memcpy(haddr, p, len);
+			} else {
+				for (int i = 0; i < len; i++)
+					haddr[i] = get_byte(addr + i);
 			}
+			haddr += len;
+			addr += len;
+			cnt -= len;
 		}
 	}
 }
@@ -1265,14 +1374,8 @@ int trap_put_string(TrapContext *ctx, const void *haddrp, uaecptr addr, int maxl
 		}
 		call_hardware_trap_back(ctx, TRAPCMD_PUT_STRING, ctx->amiga_trap_data + RTAREA_TRAP_DATA_EXTRA, addr, maxlen, 0);
 	} else {
-		for (;;) {
-			uae_u8 v = *haddr++;
-			put_byte(addr, v);
-			addr++;
-			if (!v)
-				break;
-			len++;
-		}
+		len = strlen((char*)haddr);
+		trap_put_bytes(ctx, haddr, addr, len + 1);
 	}
 	return len;
 }
@@ -1291,14 +1394,29 @@ int trap_get_string(TrapContext *ctx, void *haddrp, uaecptr addr, int maxlen)
 			len++;
 		}
 	} else {
-		for (;;) {
-			uae_u8 v = get_byte(addr);
-			*haddr++ = v;
-			addr++;
-			if (!v)
+		while (len < maxlen - 1) {
+			uae_u8 *p;
+			int run = trap_bank_run(addr, maxlen - 1 - len, &p);
+			int i;
+			if (p) {
+				uae_u8 *z = (uae_u8*)memchr(p, 0, run);
+				i = z ? z - p : run;
+				memcpy(haddr + len, p, i);
+			} else {
+				for (i = 0; i < run; i++) {
+					uae_u8 v = get_byte(addr + i);
+					if (!v)
+						break;
+					haddr[len + i] = v;
+				}
+			}
+			len += i;
+			addr += i;
+			if (i < run)
 				break;
 		}
-		len++;
+		if (maxlen > 0)
+			haddr[len] = 0;
 	}
 	return len;
 }
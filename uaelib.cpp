@@ -184,13 +184,14 @@ static uae_u32 REGPARAM2 emulib_ChgFMemSize(TrapContext *ctx, uae_u32 memsize)
 */
 static uae_u32 emulib_InsertDisk(TrapContext *ctx, uaecptr name, uae_u32 drive)
 {
-	char real_name[256];
+	char real_name[256 + 1];
 	TCHAR *s;
 
 	if (drive > 3)
 		return 0;
 
-	if (trap_get_string(ctx, real_name, name, sizeof real_name) >= sizeof real_name)
+	/* one extra byte so that too long name is still detectable */
+	if (trap_get_string(ctx, real_name, name, sizeof real_name) >= sizeof real_name - 1)
 		return 0; /* ENAMETOOLONG */
 
 	s = au (real_name);
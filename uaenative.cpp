@@ -98,6 +98,14 @@ static void * UNICALL uni_resolve(uae_u32 ptr)
     return result;
 }
 
+static void * UNICALL uni_resolve_range(uae_u32 ptr, uae_u32 size)
+{
+    // emulated RAM never moves, so the pointer stays valid during the call
+    if (!size || !valid_address (ptr, size))
+        return NULL;
+    return get_real_address (ptr);
+}
+
 static const char * UNICALL uni_uae_version(void)
 {
     // A standard GNU macro with a string containing program name and
@@ -210,6 +218,9 @@ static void set_library_globals(void *dl)
     address = dl_symbol(dl, "uni_resolve");
     if (address) *((uni_resolve_function *) address) = &uni_resolve;
 
+    address = dl_symbol(dl, "uni_resolve_range");
+    if (address) *((uni_resolve_range_function *) address) = &uni_resolve_range;
+
     address = dl_symbol(dl, "uni_uae_version");
     if (address) *((uni_uae_version_function *) address) = &uni_uae_version;
 }
@@ -414,8 +425,6 @@ static uae_u32 do_call_function_compat_asm (struct uni *uni)
 
 static void do_call_function (struct uni *uni)
 {
-    printf("uni: calling native function %p\n", uni->native_function);
-
     unsigned long start_time;
     const int flags = uni->flags;
     if ((flags & UNI_FLAG_ASYNCHRONOUS) == 0) {
@@ -444,7 +453,7 @@ static void do_call_function (struct uni *uni)
                 v = 1000000 * CYCLE_UNIT;
             }
             // compensate for the time spent in the native function
-            do_extra_cycles ((unsigned long) (syncdivisor * time_diff));
+            do_extra_cycles ((unsigned long) v);
         }
     }
 }